@@ -0,0 +1,63 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "microbench.hh"
+
+#include <cstdlib>
+#include <new>
+
+/*
+  Count allocations for the benchmarks.  This replaces the global
+  operator new, so it is only linked into the benchmark programs,
+  never into the library or lilypond itself.  The nothrow and sized
+  forms keep their library definitions, which call these.
+*/
+void *
+operator new (size_t size)
+{
+  if (Microbench::counting_allocations_)
+    Microbench::allocations_++;
+  for (;;)
+    {
+      if (void *p = malloc (size ? size : 1))
+        return p;
+      std::new_handler handler = std::get_new_handler ();
+      if (!handler)
+        abort ();
+      handler ();
+    }
+}
+
+void *
+operator new[] (size_t size)
+{
+  return operator new (size);
+}
+
+void
+operator delete (void *p) noexcept
+{
+  free (p);
+}
+
+void
+operator delete[] (void *p) noexcept
+{
+  free (p);
+}
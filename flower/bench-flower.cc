@@ -0,0 +1,165 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Microbenchmarks of the flower data structures.  Run
+
+    out/bench-flower [FILTER]
+
+  to time the benchmarks whose name contains FILTER.
+*/
+
+#include "interval-set.hh"
+#include "microbench.hh"
+#include "polynomial.hh"
+#include "rational.hh"
+
+#include <cstdio>
+
+using std::pair;
+using std::string;
+using std::vector;
+
+/*
+  Durations as they occur in music: mostly binary, some tuplets.
+
+  The denominators are estimated by hand from the note values written
+  in input/benchmark, mostly eighths and quarters with the sixteenths
+  and triplets of piano.ly; they are not captured from a run.
+*/
+static vector<Rational>
+random_durations (vsize count)
+{
+  static const vector<pair<vsize, Real> > denominators
+  = {{1, 2}, {2, 8}, {4, 30}, {8, 30}, {16, 15}, {32, 3},
+    {3, 4}, {6, 3}, {12, 3}, {5, 1}, {7, 1}};
+  vector<Rational> durations;
+  for (vsize i = 0; i < count; i++)
+    {
+      I64 num = (Microbench::random () () % 3) + 1;
+      durations.push_back (Rational (num,
+                                     Microbench::draw_size (denominators)));
+    }
+  return durations;
+}
+
+MICROBENCHMARK (rational_sum)
+{
+  static vector<Rational> durations = random_durations (1024);
+  Rational sum;
+  for (vsize i = 0; i < iterations; i++)
+    sum += durations[i % durations.size ()];
+  Microbench::keep (sum);
+}
+
+MICROBENCHMARK (rational_compare)
+{
+  static vector<Rational> durations = random_durations (1024);
+  int less = 0;
+  for (vsize i = 0; i < iterations; i++)
+    less += durations[i % 1024] < durations[(i + 1) % 1024];
+  Microbench::keep (less);
+}
+
+/*
+  Intervals forbidden for a beam or a ledger line: a handful of
+  overlapping note head extents.
+
+  The list lengths are estimated by hand from the chords and beamed
+  groups of input/benchmark, mostly two to four heads with the long
+  beams of piano.ly as the tail; they are not captured from a run.
+*/
+static vector<vector<Interval> >
+random_interval_lists (vsize count)
+{
+  static const vector<pair<vsize, Real> > sizes
+  = {{1, 20}, {2, 30}, {3, 20}, {4, 10}, {6, 10}, {10, 6}, {20, 4}};
+  std::uniform_real_distribution<Real> position (0.0, 20.0);
+  std::uniform_real_distribution<Real> width (0.5, 2.0);
+  vector<vector<Interval> > lists (count);
+  for (vector<Interval> &list : lists)
+    for (vsize i = Microbench::draw_size (sizes); i--;)
+      {
+        Real start = position (Microbench::random ());
+        list.push_back (Interval (start,
+                                  start + width (Microbench::random ())));
+      }
+  return lists;
+}
+
+MICROBENCHMARK (interval_set_union)
+{
+  static vector<vector<Interval> > lists = random_interval_lists (256);
+  for (vsize i = 0; i < iterations; i++)
+    Microbench::keep (Interval_set::interval_union (lists[i % lists.size ()]));
+}
+
+MICROBENCHMARK (interval_set_complement)
+{
+  static vector<Interval_set> sets;
+  if (sets.empty ())
+    for (vector<Interval> const &list : random_interval_lists (256))
+      sets.push_back (Interval_set::interval_union (list));
+  for (vsize i = 0; i < iterations; i++)
+    Microbench::keep (sets[i % sets.size ()].complement ());
+}
+
+/* The cubic polynomials of Bezier curves, as used by slurs and ties.  */
+static vector<Polynomial>
+random_cubics (vsize count)
+{
+  std::uniform_real_distribution<Real> coef (-10.0, 10.0);
+  vector<Polynomial> cubics (count);
+  for (Polynomial &p : cubics)
+    for (int i = 0; i < 4; i++)
+      p.coefs_.push_back (coef (Microbench::random ()));
+  return cubics;
+}
+
+MICROBENCHMARK (polynomial_solve_cubic)
+{
+  static vector<Polynomial> cubics = random_cubics (256);
+  for (vsize i = 0; i < iterations; i++)
+    Microbench::keep (cubics[i % cubics.size ()].solve ());
+}
+
+MICROBENCHMARK (polynomial_multiply)
+{
+  static vector<Polynomial> cubics = random_cubics (256);
+  for (vsize i = 0; i < iterations; i++)
+    Microbench::keep (Polynomial::multiply (cubics[i % 256],
+                                            cubics[(i + 1) % 256]));
+}
+
+MICROBENCHMARK (polynomial_eval)
+{
+  static vector<Polynomial> cubics = random_cubics (256);
+  Real sum = 0.0;
+  for (vsize i = 0; i < iterations; i++)
+    sum += cubics[i % cubics.size ()].eval (Real (i % 100) / 100);
+  Microbench::keep (sum);
+}
+
+int
+main (int argc, char **argv)
+{
+  string filter = argc > 1 ? argv[1] : "";
+  fputs (Microbench::report (Microbench::run (filter)).c_str (), stdout);
+  return 0;
+}
@@ -19,6 +19,7 @@
 
 #include "cpu-timer.hh"
 
+#include <ctime>
 #include <unistd.h>
 // nextstep
 #ifndef CLOCKS_PER_SEC
@@ -31,20 +32,91 @@
 #endif
 #endif
 
+using std::map;
+using std::string;
+using std::vector;
+
+thread_local vector<Cpu_timer::Open_scope> Cpu_timer::open_;
+thread_local map<string, Cpu_timer::Total> Cpu_timer::totals_;
+
 Cpu_timer::Cpu_timer ()
 {
   restart ();
 }
+
 void
 Cpu_timer::restart ()
 {
-  start_clock_ = clock ();
+  start_wall_ = Clock::now ();
+  start_cpu_ = thread_cpu_time ();
+}
+
+Real
+Cpu_timer::wall () const
+{
+  return std::chrono::duration<Real> (Clock::now () - start_wall_).count ();
 }
 
 Real
-Cpu_timer::read ()
+Cpu_timer::cpu () const
 {
-  clock_t stop = clock ();
-  return static_cast<Real> (stop - start_clock_)
-         / static_cast<Real> (CLOCKS_PER_SEC);
+  return thread_cpu_time () - start_cpu_;
+}
+
+Real
+Cpu_timer::thread_cpu_time ()
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  struct timespec ts;
+  if (clock_gettime (CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+    return static_cast<Real> (ts.tv_sec) + 1e-9 * static_cast<Real> (ts.tv_nsec);
+#endif
+  // Without a thread clock, fall back to the process clock.
+  return static_cast<Real> (clock ()) / static_cast<Real> (CLOCKS_PER_SEC);
+}
+
+vsize
+Cpu_timer::begin_scope (string const &name)
+{
+  open_.push_back ({name, Clock::now (), thread_cpu_time (), 0.0});
+  return open_.size () - 1;
+}
+
+Real
+Cpu_timer::scope_wall (vsize depth)
+{
+  return std::chrono::duration<Real> (Clock::now ()
+                                      - open_[depth].start_wall_)
+         .count ();
+}
+
+void
+Cpu_timer::end_scope (vsize depth)
+{
+  while (open_.size () > depth)
+    {
+      Open_scope scope = open_.back ();
+      open_.pop_back ();
+
+      Real wall
+        = std::chrono::duration<Real> (Clock::now () - scope.start_wall_)
+          .count ();
+      Real cpu = thread_cpu_time () - scope.start_cpu_;
+
+      Total &t = totals_[scope.name_];
+      t.count_++;
+      t.self_wall_ += wall - scope.children_wall_;
+
+      bool recursive = false;
+      for (Open_scope const &outer : open_)
+        recursive = recursive || outer.name_ == scope.name_;
+      if (!recursive)
+        {
+          t.wall_ += wall;
+          t.cpu_ += cpu;
+        }
+
+      if (!open_.empty ())
+        open_.back ().children_wall_ += wall;
+    }
 }
@@ -0,0 +1,92 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef ARENA_HH
+#define ARENA_HH
+
+#include "std-vector.hh"
+
+#include <new>
+#include <utility>
+
+/*
+  Storage for many objects of one type that all die together, like
+  the candidate configurations of a scoring problem.  Objects are
+  placed in large chunks and destroyed when the arena is, saving a
+  malloc and free for each of them.  Objects never move, so pointers
+  to them stay valid for the life of the arena.
+*/
+template<class T>
+class Arena
+{
+  std::vector<T *> chunks_;
+  size_t chunk_size_;
+  size_t used_;                 // in the last chunk
+  size_t size_;
+
+public:
+  explicit Arena (size_t chunk_size = 256)
+    : chunk_size_ (chunk_size ? chunk_size : 1), used_ (0), size_ (0)
+  {
+  }
+
+  ~Arena ()
+  {
+    clear ();
+  }
+
+  Arena (Arena const &) = delete;
+  Arena &operator = (Arena const &) = delete;
+
+  // Construct a T from ARGS in the arena.
+  template<class... Args>
+  T *make (Args &&... args)
+  {
+    if (chunks_.empty () || used_ == chunk_size_)
+      {
+        chunks_.push_back (static_cast<T *>
+                           (::operator new (chunk_size_ * sizeof (T))));
+        used_ = 0;
+      }
+    T *p = new (chunks_.back () + used_) T (std::forward<Args> (args)...);
+    used_++;
+    size_++;
+    return p;
+  }
+
+  // Destroy all objects and release the memory.
+  void clear ()
+  {
+    for (size_t c = 0; c < chunks_.size (); c++)
+      {
+        size_t n = (c + 1 == chunks_.size ()) ? used_ : chunk_size_;
+        for (size_t i = 0; i < n; i++)
+          chunks_[c][i].~T ();
+        ::operator delete (chunks_[c]);
+      }
+    chunks_.clear ();
+    used_ = 0;
+    size_ = 0;
+  }
+
+  size_t size () const { return size_; }
+};
+
+#endif /* ARENA_HH */
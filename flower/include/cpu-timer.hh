@@ -20,17 +20,90 @@
 #ifndef CPU_TIMER_HH
 #define CPU_TIMER_HH
 
-#include <ctime>
+#include <chrono>
+#include <map>
 
 #include "real.hh"
+#include "std-string.hh"
+#include "std-vector.hh"
 
+/*
+  Measure elapsed time on the monotonic clock, and CPU time of the
+  calling thread.
+
+  Named scopes nest, and their times are added up by name, per
+  thread.  A scope entered again while it is open (recursion) counts
+  its wall and CPU time only once.
+*/
 class Cpu_timer
 {
-  clock_t start_clock_;
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  struct Total
+  {
+    vsize count_;
+    Real wall_;
+    Real cpu_;
+    // Wall time outside nested scopes.
+    Real self_wall_;
+  };
+
+private:
+  Clock::time_point start_wall_;
+  Real start_cpu_;
+
+  struct Open_scope
+  {
+    std::string name_;
+    Clock::time_point start_wall_;
+    Real start_cpu_;
+    Real children_wall_;
+  };
+
+  static thread_local std::vector<Open_scope> open_;
+  static thread_local std::map<std::string, Total> totals_;
+
 public:
   Cpu_timer ();
   void restart ();
-  Real read ();
+
+  // Wall-clock seconds since the last restart, on the monotonic clock.
+  Real wall () const;
+  // CPU seconds of this thread since the last restart.
+  Real cpu () const;
+
+  // CPU seconds used by the calling thread so far.
+  static Real thread_cpu_time ();
+
+  // Open a named scope; return its depth for end_scope ().
+  static vsize begin_scope (std::string const &name);
+  // Close the scopes at DEPTH and deeper, innermost first.
+  static void end_scope (vsize depth);
+  static vsize open_scope_count () { return open_.size (); }
+  // Wall-clock seconds since the scope at DEPTH was opened.
+  static Real scope_wall (vsize depth);
+
+  static std::map<std::string, Total> const &totals () { return totals_; }
+  static void clear_totals () { totals_.clear (); }
+
+  /* Time a named scope for the lifetime of the object. */
+  class Scope
+  {
+  public:
+    Scope (std::string const &name)
+      : depth_ (begin_scope (name))
+    {
+    }
+    ~Scope () { end_scope (depth_); }
+    // Wall-clock seconds since this scope was opened.
+    Real wall () const { return scope_wall (depth_); }
+    Scope (Scope const &) = delete;
+    Scope &operator = (Scope const &) = delete;
+
+  private:
+    vsize depth_;
+  };
 };
 
 #endif // CPU_TIMER_HH
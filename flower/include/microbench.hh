@@ -0,0 +1,102 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MICROBENCH_HH
+#define MICROBENCH_HH
+
+#include "real.hh"
+#include "std-string.hh"
+#include "std-vector.hh"
+
+#include <random>
+
+/*
+  Time single operations on core data structures in isolation.
+
+  A benchmark body runs its operation ITERATIONS times.  The harness
+  grows ITERATIONS until a run is long enough to time, and reports the
+  wall time and the number of memory allocations per operation.
+
+  Bodies should prepare their input outside the loop, for example in
+  function-level statics: the short calibration runs absorb that cost.
+
+    MICROBENCHMARK (interval_union)
+    {
+      static vector<Interval> input = ...;
+      for (vsize i = 0; i < iterations; i++)
+        Microbench::keep (Interval_set::interval_union (input));
+    }
+*/
+class Microbench
+{
+public:
+  typedef void (*Body) (vsize iterations);
+
+  struct Result
+  {
+    std::string name_;
+    vsize iterations_;
+    Real ns_per_op_;
+    Real allocations_per_op_;
+  };
+
+private:
+  static Microbench *list_;
+  Microbench *const next_;
+  char const *name_;
+  Body body_;
+  Microbench (const Microbench &);  // don't define copy constructor
+
+public:
+  Microbench (char const *name, Body body)
+    : next_ (list_), name_ (name), body_ (body)
+  { list_ = this; }
+
+  // Operator new counts allocations while this is set, if the
+  // replacement in bench-allocations.cc is linked in.
+  static bool counting_allocations_;
+  static size_t allocations_;
+
+  // Run the benchmarks whose name contains FILTER, in name order.
+  // Each measured run lasts about MIN_TIME seconds.
+  static std::vector<Result> run (std::string const &filter,
+                                  Real min_time = 0.2);
+  static std::string report (std::vector<Result> const &results);
+
+  // Keep the compiler from optimizing away the computation of VALUE:
+  // the empty asm claims to read it.
+  template<class T> static void keep (T const &value)
+  {
+    asm volatile ("" : : "g" (value) : "memory");
+  }
+
+  // A reproducible source of random input data.
+  static std::mt19937 &random ();
+
+  // Draw a size from a table of (size, weight) pairs.
+  static vsize draw_size (std::vector<std::pair<vsize, Real> > const &table);
+};
+
+#define MICROBENCHMARK(name)                                            \
+  static void name ## _microbenchmark (vsize iterations);              \
+  static Microbench name ## _microbenchmark_entry                      \
+    (#name, name ## _microbenchmark);                                   \
+  static void name ## _microbenchmark (vsize iterations)
+
+#endif /* MICROBENCH_HH */
@@ -34,6 +34,7 @@ public:
   static std::string unsigned2hex (unsigned u, size_t length, char ch);
   static std::string to_lower (std::string s);
   static std::string to_upper (std::string s);
+  static std::string json_quote (const std::string &s);
 };
 
 #endif // __STRING_CONVERT_HH //
@@ -0,0 +1,114 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "microbench.hh"
+
+#include "cpu-timer.hh"
+
+#include <algorithm>
+#include <cstdio>
+
+using std::pair;
+using std::string;
+using std::vector;
+
+Microbench *Microbench::list_ = 0;
+bool Microbench::counting_allocations_ = false;
+size_t Microbench::allocations_ = 0;
+
+/* Run BODY for ITERATIONS; return the elapsed seconds.  */
+static Real
+time_run (Microbench::Body body, vsize iterations)
+{
+  Cpu_timer timer;
+  body (iterations);
+  return timer.wall ();
+}
+
+vector<Microbench::Result>
+Microbench::run (string const &filter, Real min_time)
+{
+  vector<Microbench const *> benches;
+  for (Microbench const *b = list_; b; b = b->next_)
+    if (string (b->name_).find (filter) != string::npos)
+      benches.push_back (b);
+  std::sort (benches.begin (), benches.end (),
+             [] (Microbench const *a, Microbench const *b)
+  {
+    return string (a->name_) < string (b->name_);
+  });
+
+  vector<Result> results;
+  for (Microbench const *b : benches)
+    {
+      // Calibrate: grow the run until it takes a tenth of MIN_TIME.
+      vsize iterations = 1;
+      Real t = time_run (b->body_, iterations);
+      while (t < min_time / 10)
+        {
+          iterations *= 10;
+          t = time_run (b->body_, iterations);
+        }
+      iterations = std::max<vsize> (1, vsize (Real (iterations) * min_time / t));
+
+      allocations_ = 0;
+      counting_allocations_ = true;
+      t = time_run (b->body_, iterations);
+      counting_allocations_ = false;
+
+      results.push_back ({b->name_, iterations, 1e9 * t / Real (iterations),
+                          Real (allocations_) / Real (iterations)});
+    }
+  return results;
+}
+
+string
+Microbench::report (vector<Result> const &results)
+{
+  string s;
+  char line[200];
+  snprintf (line, sizeof (line), "%-40s %12s %12s %12s\n",
+            "benchmark", "iterations", "ns/op", "allocs/op");
+  s += line;
+  for (Result const &r : results)
+    {
+      snprintf (line, sizeof (line), "%-40s %12zu %12.1f %12.2f\n",
+                r.name_.c_str (), r.iterations_, r.ns_per_op_,
+                r.allocations_per_op_);
+      s += line;
+    }
+  return s;
+}
+
+std::mt19937 &
+Microbench::random ()
+{
+  static std::mt19937 generator (20200101);
+  return generator;
+}
+
+vsize
+Microbench::draw_size (vector<pair<vsize, Real> > const &table)
+{
+  vector<Real> weights;
+  for (pair<vsize, Real> const &entry : table)
+    weights.push_back (entry.second);
+  std::discrete_distribution<vsize> pick (weights.begin (), weights.end ());
+  return table[pick (random ())].first;
+}
@@ -212,6 +212,26 @@ String_convert::to_lower (string s)
   return s;
 }
 
+/* S as a JSON string literal, including the quotes.  */
+string
+String_convert::json_quote (const string &s)
+{
+  string out = "\"";
+  for (char c : s)
+    {
+      if (c == '"' || c == '\\')
+        {
+          out += '\\';
+          out += c;
+        }
+      else if (static_cast<unsigned char> (c) < 0x20)
+        out += form_string ("\\u%04x", c);
+      else
+        out += c;
+    }
+  return out + "\"";
+}
+
 string
 String_convert::be_u16 (uint16_t u)
 {
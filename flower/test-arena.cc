@@ -0,0 +1,68 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "arena.hh"
+
+#include "yaffut.hh"
+
+#include <string>
+
+using std::string;
+using std::vector;
+
+FUNC (arena_make)
+{
+  Arena<string> arena (2);
+  vector<string *> made;
+  for (int i = 0; i < 5; i++)
+    made.push_back (arena.make (i, 'x'));
+
+  EQUAL (5u, arena.size ());
+  // Objects do not move when new chunks are added.
+  for (int i = 0; i < 5; i++)
+    EQUAL (string (i, 'x'), *made[i]);
+}
+
+struct Counted
+{
+  static int live_;
+  Counted () { live_++; }
+  ~Counted () { live_--; }
+};
+
+int Counted::live_ = 0;
+
+FUNC (arena_destroys_objects)
+{
+  {
+    Arena<Counted> arena (3);
+    for (int i = 0; i < 7; i++)
+      arena.make ();
+    EQUAL (7, Counted::live_);
+
+    arena.clear ();
+    EQUAL (0, Counted::live_);
+    EQUAL (0u, arena.size ());
+
+    arena.make ();
+    EQUAL (1, Counted::live_);
+  }
+  EQUAL (0, Counted::live_);
+}
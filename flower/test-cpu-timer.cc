@@ -0,0 +1,105 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "cpu-timer.hh"
+
+#include "yaffut.hh"
+
+static void
+spin (Real seconds)
+{
+  Cpu_timer timer;
+  while (timer.wall () < seconds)
+    ;
+}
+
+FUNC (cpu_timer_monotonic)
+{
+  Cpu_timer timer;
+  Real previous = 0.0;
+  for (int i = 0; i < 1000; i++)
+    {
+      Real now = timer.wall ();
+      CHECK (now >= previous);
+      previous = now;
+    }
+  spin (0.01);
+  CHECK (timer.wall () >= 0.01);
+  CHECK (timer.cpu () > 0.0);
+}
+
+FUNC (cpu_timer_nested_scopes)
+{
+  Cpu_timer::clear_totals ();
+  {
+    Cpu_timer::Scope outer ("outer");
+    spin (0.01);
+    for (int i = 0; i < 3; i++)
+      {
+        Cpu_timer::Scope inner ("inner");
+        spin (0.01);
+      }
+  }
+  EQUAL (0u, Cpu_timer::open_scope_count ());
+
+  Cpu_timer::Total outer = Cpu_timer::totals ().at ("outer");
+  Cpu_timer::Total inner = Cpu_timer::totals ().at ("inner");
+  EQUAL (1u, outer.count_);
+  EQUAL (3u, inner.count_);
+  CHECK (inner.wall_ >= 0.03);
+  CHECK (outer.wall_ >= outer.self_wall_ + inner.wall_ - 1e-9);
+  CHECK (outer.self_wall_ >= 0.01);
+}
+
+FUNC (cpu_timer_scope_wall)
+{
+  Cpu_timer::clear_totals ();
+  Real elapsed = 0.0;
+  {
+    Cpu_timer::Scope scope ("scope");
+    spin (0.01);
+    elapsed = scope.wall ();
+  }
+  CHECK (elapsed >= 0.01);
+  CHECK (Cpu_timer::totals ().at ("scope").wall_ >= elapsed);
+}
+
+FUNC (cpu_timer_recursion_counts_once)
+{
+  Cpu_timer::clear_totals ();
+  Cpu_timer outer;
+  vsize depth = Cpu_timer::begin_scope ("rec");
+  spin (0.01);
+  Cpu_timer inner;
+  Cpu_timer::begin_scope ("rec");
+  spin (0.01);
+  Real inner_wall = inner.wall ();
+  // Closing the outer scope also closes the one inside it.
+  Cpu_timer::end_scope (depth);
+  Real outer_wall = outer.wall ();
+  EQUAL (0u, Cpu_timer::open_scope_count ());
+
+  // Only the outer scope's time counts.  Both levels together would
+  // add up to more than the time that passed around the outer scope.
+  Cpu_timer::Total rec = Cpu_timer::totals ().at ("rec");
+  EQUAL (2u, rec.count_);
+  CHECK (rec.wall_ <= outer_wall);
+  CHECK (rec.wall_ >= outer_wall - inner_wall);
+  CHECK (rec.self_wall_ >= rec.wall_ - 1e-9);
+}
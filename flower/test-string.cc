@@ -22,6 +22,7 @@
 
 #include <iostream>
 
+#include "string-convert.hh"
 #include "yaffut.hh"
 
 using std::string;
@@ -35,3 +36,10 @@ FUNC (string_split_join)
   EQUAL (orig, loop);
   EQUAL (splits.size (), size_t (5));
 }
+
+FUNC (string_convert_json_quote)
+{
+  EQUAL (String_convert::json_quote ("abc"), string ("\"abc\""));
+  EQUAL (String_convert::json_quote ("a\"b\\c"), string ("\"a\\\"b\\\\c\""));
+  EQUAL (String_convert::json_quote ("a\nb"), string ("\"a\\u000ab\""));
+}
@@ -19,6 +19,7 @@
 
 #include "all-font-metrics.hh"
 
+#include "font-metric-cache.hh"
 #include "string-convert.hh"
 #include "international.hh"
 #include "main.hh"
@@ -37,7 +38,13 @@ All_font_metrics::get_index_to_charcode_map (const string &filename,
   string key = filename + String_convert::int_string (face_index);
   if (filename_charcode_maps_map_.find (key)
       == filename_charcode_maps_map_.end ())
-    filename_charcode_maps_map_[key] = make_index_to_charcode_map (face);
+    {
+      Font_metric_cache cache;
+      if (cache.fill_charcode_map (filename, face_index, face))
+        filename_charcode_maps_map_[key] = cache.index_to_charcode_map ();
+      else
+        filename_charcode_maps_map_[key] = make_index_to_charcode_map (face);
+    }
 
   return &filename_charcode_maps_map_[key];
 }
@@ -51,20 +58,32 @@ All_font_metrics::All_font_metrics (const string &path)
   otf_dict_ = unsmob<Scheme_hash_table> (Scheme_hash_table::make_smob ());
 
   pango_dict_ = unsmob<Scheme_hash_table> (Scheme_hash_table::make_smob ());
-  PangoFontMap *pfm = pango_ft2_font_map_new ();
-
-  pango_ft2_fontmap_ = PANGO_FT2_FONT_MAP (pfm);
-
+  pango_ft2_fontmap_ = 0;
   pango_dpi_ = PANGO_RESOLUTION;
-  pango_ft2_font_map_set_resolution (pango_ft2_fontmap_,
-                                     pango_dpi_, pango_dpi_);
 
   search_path_.parse_path (path);
 }
 
 All_font_metrics::~All_font_metrics ()
 {
-  g_object_unref (pango_ft2_fontmap_);
+  if (pango_ft2_fontmap_)
+    g_object_unref (pango_ft2_fontmap_);
+}
+
+/* Only set up FontConfig and Pango once a text font is needed. */
+PangoFT2FontMap *
+All_font_metrics::pango_font_map ()
+{
+  if (!pango_ft2_fontmap_)
+    {
+      init_fontconfig ();
+
+      PangoFontMap *pfm = pango_ft2_font_map_new ();
+      pango_ft2_fontmap_ = PANGO_FT2_FONT_MAP (pfm);
+      pango_ft2_font_map_set_resolution (pango_ft2_fontmap_,
+                                         pango_dpi_, pango_dpi_);
+    }
+  return pango_ft2_fontmap_;
 }
 
 SCM
@@ -90,7 +109,7 @@ All_font_metrics::find_pango_font (PangoFontDescription const *description,
     {
       debug_output ("[" + string (pango_fn), true); // start on a new line
 
-      Pango_font *pf = new Pango_font (pango_ft2_fontmap_,
+      Pango_font *pf = new Pango_font (pango_font_map (),
                                        description,
                                        output_scale
                                       );
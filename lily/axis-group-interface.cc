@@ -197,7 +197,22 @@ Axis_group_interface::part_of_line_pure_height (Grob *me, bool begin, vsize star
                                : scm_cdr (adjacent_pure_heights);
 
       if (scm_is_vector (these_pure_heights))
-        ret = combine_pure_heights (me, these_pure_heights, start, end);
+        {
+          /* Line breaking asks for START with increasing END.  Since the
+             height is a union over measures, extend the height up to the
+             previous breakpoint, if we know it, instead of starting over. */
+          vsize mid = begin ? start : previous_break_rank (me, start, end);
+          SCM prefix = (mid > start)
+                       ? sp->get_cached_pure_property (cache_symbol, start, mid)
+                       : SCM_UNDEFINED;
+          if (scm_is_pair (prefix))
+            {
+              ret = from_scm (prefix, Interval (0, 0));
+              ret.unite (combine_pure_heights (me, these_pure_heights, mid, end));
+            }
+          else
+            ret = combine_pure_heights (me, these_pure_heights, start, end);
+        }
       else
         ret = Interval (0, 0);
     }
@@ -218,6 +233,19 @@ Axis_group_interface::rest_of_line_pure_height (Grob *me, vsize start, vsize end
   return part_of_line_pure_height (me, false, start, end);
 }
 
+/* The rank of the last breakpoint strictly between START and END, or START
+   if there is none. */
+vsize
+Axis_group_interface::previous_break_rank (Grob *me, vsize start, vsize end)
+{
+  Paper_score *ps = get_root_system (me)->paper_score ();
+  vector<vsize> const &break_ranks = ps->get_break_ranks ();
+  auto it = lower_bound (break_ranks.begin (), break_ranks.end (), end);
+  if (it == break_ranks.begin () || *(it - 1) <= start)
+    return start;
+  return *(it - 1);
+}
+
 Interval
 Axis_group_interface::combine_pure_heights (Grob *me, SCM measure_extents,
                                             vsize start, vsize end)
@@ -46,13 +46,11 @@
 
 #include <algorithm>
 #include <cmath>
-#include <memory>
 #include <queue>
 #include <set>
 
 using std::set;
 using std::string;
-using std::unique_ptr;
 using std::vector;
 
 Real
@@ -133,19 +131,19 @@ void Beam_configuration::add (Real demerit, const string &reason)
 #endif
 }
 
-unique_ptr<Beam_configuration>
+Beam_configuration
 Beam_configuration::new_config (Drul_array<Real> start,
                                 Drul_array<Real> offset)
 {
-  unique_ptr<Beam_configuration> qs (new Beam_configuration);
-  qs->y = Drul_array<Real> (int (start[LEFT]) + offset[LEFT],
-                            int (start[RIGHT]) + offset[RIGHT]);
+  Beam_configuration qs;
+  qs.y = Drul_array<Real> (int (start[LEFT]) + offset[LEFT],
+                           int (start[RIGHT]) + offset[RIGHT]);
 
   // This orders the sequence so we try combinations closest to the
   // the ideal offset first.
   Real start_score = abs (offset[RIGHT]) + abs (offset[LEFT]);
-  qs->demerits = start_score / 1000.0;
-  qs->next_scorer_todo = ORIGINAL_DISTANCE + 1;
+  qs.demerits = start_score / 1000.0;
+  qs.next_scorer_todo = ORIGINAL_DISTANCE + 1;
 
   return qs;
 }
@@ -865,7 +863,8 @@ Beam_scoring_problem::shift_region_to_valid ()
 }
 
 void
-Beam_scoring_problem::generate_quants (vector<unique_ptr<Beam_configuration>> *scores) const
+Beam_scoring_problem::generate_quants (Arena<Beam_configuration> *arena,
+                                       vector<Beam_configuration *> *scores) const
 {
   int region_size = (int) parameters_.REGION_SIZE;
 
@@ -910,21 +909,16 @@ Beam_scoring_problem::generate_quants (vector<unique_ptr<Beam_configuration>> *s
             /* apply grid shift if quant outside 5-line staff: */
             if ((unquanted_y_[d] + unshifted_quants[i]) * edge_dirs_[d] > 2.5)
               corr[d] = grid_shift * edge_dirs_[d];
-        auto c = Beam_configuration::new_config
-          (unquanted_y_,
-           Drul_array<Real> (unshifted_quants[i] - corr[LEFT],
-                             unshifted_quants[j] - corr[RIGHT]));
+        Drul_array<Real> offset (unshifted_quants[i] - corr[LEFT],
+                                 unshifted_quants[j] - corr[RIGHT]);
+        Beam_configuration c
+          = Beam_configuration::new_config (unquanted_y_, offset);
 
+        bool valid = true;
         for (LEFT_and_RIGHT (d))
-          {
-            if (!quant_range_[d].contains (c->y[d]))
-              {
-                c.reset ();
-                break;
-              }
-          }
-        if (c)
-          scores->push_back (std::move (c));
+          valid = valid && quant_range_[d].contains (c.y[d]);
+        if (valid)
+          scores->push_back (arena->make (c));
       }
 
 }
@@ -966,7 +960,7 @@ void Beam_scoring_problem::one_scorer (Beam_configuration *config) const
 
 Beam_configuration *
 Beam_scoring_problem::force_score (SCM inspect_quants,
-                                   const vector<unique_ptr<Beam_configuration>> &configs) const
+                                   const vector<Beam_configuration *> &configs) const
 {
   Drul_array<Real> ins = from_scm<Drul_array<Real>> (inspect_quants);
   Real mindist = 1e6;
@@ -976,7 +970,7 @@ Beam_scoring_problem::force_score (SCM inspect_quants,
       Real d = fabs (configs[i]->y[LEFT] - ins[LEFT]) + fabs (configs[i]->y[RIGHT] - ins[RIGHT]);
       if (d < mindist)
         {
-          best = configs[i].get ();
+          best = configs[i];
           mindist = d;
         }
     }
@@ -992,8 +986,11 @@ Beam_scoring_problem::force_score (SCM inspect_quants,
 Drul_array<Real>
 Beam_scoring_problem::solve () const
 {
-  vector<unique_ptr<Beam_configuration>> configs;
-  generate_quants (&configs);
+  /* Many hundreds of configurations for a single beam; keep them in
+     one arena, freed when we return.  */
+  Arena<Beam_configuration> arena;
+  vector<Beam_configuration *> configs;
+  generate_quants (&arena, &configs);
 
   if (configs.empty ())
     {
@@ -1019,7 +1016,7 @@ Beam_scoring_problem::solve () const
       std::priority_queue < Beam_configuration *, std::vector<Beam_configuration *>,
           Beam_configuration_less > queue;
       for (vsize i = 0; i < configs.size (); i++)
-        queue.push (configs[i].get ());
+        queue.push (configs[i]);
 
       /*
         TODO
@@ -0,0 +1,238 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Microbenchmarks of the layout data structures.  Run
+
+    out/bench-lilypond [FILTER]
+
+  to time the benchmarks whose name contains FILTER.  The flower
+  structures have their own benchmark program, see
+  flower/bench-flower.cc.
+*/
+
+#include "bezier.hh"
+#include "microbench.hh"
+#include "simple-spacer.hh"
+#include "skyline.hh"
+#include "spring.hh"
+#include "transform.hh"
+
+#include <cstdio>
+
+using std::pair;
+using std::string;
+using std::vector;
+
+/*
+  The boxes of a grob stencil: mostly a few glyphs, sometimes many
+  (a long text or a beamed group).
+
+  The size table is estimated by hand, not captured from a run: note
+  heads, accidentals and articulations in orchestra.ly and piano.ly
+  of input/benchmark give one or two boxes, beamed groups and chords
+  up to about 16, and the texts of markups.ly the long tail.  To
+  replace it, count the boxes passed to Skyline::Skyline while
+  running the scores of input/benchmark/benchmarks.txt.
+*/
+static vector<vector<Box> >
+random_box_lists (vsize count)
+{
+  static const vector<pair<vsize, Real> > sizes
+  = {{1, 30}, {2, 20}, {4, 20}, {8, 15}, {16, 8}, {64, 5}, {256, 2}};
+  std::uniform_real_distribution<Real> position (0.0, 100.0);
+  std::uniform_real_distribution<Real> size (0.2, 3.0);
+  vector<vector<Box> > lists (count);
+  for (vector<Box> &boxes : lists)
+    for (vsize i = Microbench::draw_size (sizes); i--;)
+      {
+        Real x = position (Microbench::random ());
+        Real y = position (Microbench::random ()) / 20;
+        boxes.push_back (Box (Interval (x, x + size (Microbench::random ())),
+                              Interval (y, y + size (Microbench::random ()))));
+      }
+  return lists;
+}
+
+static vector<Skyline> const &
+random_skylines ()
+{
+  static vector<Skyline> skylines;
+  if (skylines.empty ())
+    for (vector<Box> const &boxes : random_box_lists (256))
+      skylines.push_back (Skyline (boxes, X_AXIS, UP));
+  return skylines;
+}
+
+MICROBENCHMARK (skyline_construct)
+{
+  static vector<vector<Box> > lists = random_box_lists (256);
+  for (vsize i = 0; i < iterations; i++)
+    Microbench::keep (Skyline (lists[i % lists.size ()], X_AXIS, UP));
+}
+
+MICROBENCHMARK (skyline_merge)
+{
+  vector<Skyline> const &skylines = random_skylines ();
+  for (vsize i = 0; i < iterations; i++)
+    {
+      Skyline merged = skylines[i % 256];
+      merged.merge (skylines[(i + 1) % 256]);
+      Microbench::keep (merged);
+    }
+}
+
+MICROBENCHMARK (skyline_distance)
+{
+  vector<Skyline> const &skylines = random_skylines ();
+  static vector<Skyline> downs;
+  if (downs.empty ())
+    for (vector<Box> const &boxes : random_box_lists (256))
+      downs.push_back (Skyline (boxes, X_AXIS, DOWN));
+  Real sum = 0.0;
+  for (vsize i = 0; i < iterations; i++)
+    sum += skylines[i % 256].distance (downs[(i + 7) % 256], 0.1);
+  Microbench::keep (sum);
+}
+
+/*
+  The springs and rods of a line: a few dozen columns, with rods
+  between neighbours and some over longer ranges.  Each operation
+  copies the spacer before solving it.
+
+  The column counts are estimated by hand, not captured from a run:
+  a line of the benchmark scores holds three to eight measures of
+  four to eight note columns, with the sixteenths of piano.ly at the
+  top of the range.  To replace them, count the springs of each
+  Simple_spacer solved while running the scores of
+  input/benchmark/benchmarks.txt.
+*/
+static vector<Simple_spacer> const &
+random_spacers ()
+{
+  static vector<Simple_spacer> spacers;
+  if (!spacers.empty ())
+    return spacers;
+
+  static const vector<pair<vsize, Real> > sizes
+  = {{8, 10}, {16, 30}, {32, 35}, {64, 20}, {128, 5}};
+  std::uniform_real_distribution<Real> distance (1.0, 4.0);
+  for (vsize n = 0; n < 64; n++)
+    {
+      Simple_spacer spacer;
+      vsize columns = Microbench::draw_size (sizes);
+      for (vsize i = 0; i < columns; i++)
+        spacer.add_spring (Spring (distance (Microbench::random ()), 1.0));
+      for (vsize i = 0; i + 1 < columns; i++)
+        {
+          spacer.add_rod (i, i + 1, distance (Microbench::random ()));
+          if (i + 4 < columns && Microbench::random () () % 4 == 0)
+            spacer.add_rod (i, i + 4, 4 * distance (Microbench::random ()));
+        }
+      spacers.push_back (spacer);
+    }
+  return spacers;
+}
+
+MICROBENCHMARK (simple_spacer_solve)
+{
+  vector<Simple_spacer> const &spacers = random_spacers ();
+  for (vsize i = 0; i < iterations; i++)
+    {
+      Simple_spacer spacer = spacers[i % spacers.size ()];
+      spacer.solve (Real (8 * (i % 32) + 40), false);
+      Microbench::keep (spacer.force ());
+    }
+}
+
+static vector<Bezier>
+random_curves (vsize count)
+{
+  std::uniform_real_distribution<Real> coordinate (0.0, 10.0);
+  vector<Bezier> curves (count);
+  for (Bezier &b : curves)
+    for (int i = 0; i < Bezier::CONTROL_COUNT; i++)
+      b.control_[i] = Offset (coordinate (Microbench::random ()) + 3 * i,
+                              coordinate (Microbench::random ()) / 3);
+  return curves;
+}
+
+MICROBENCHMARK (bezier_curve_point)
+{
+  static vector<Bezier> curves = random_curves (256);
+  Real sum = 0.0;
+  for (vsize i = 0; i < iterations; i++)
+    sum += curves[i % 256].curve_point (Real (i % 64) / 64)[Y_AXIS];
+  Microbench::keep (sum);
+}
+
+MICROBENCHMARK (bezier_get_other_coordinate)
+{
+  static vector<Bezier> curves = random_curves (256);
+  Real sum = 0.0;
+  for (vsize i = 0; i < iterations; i++)
+    {
+      Bezier const &b = curves[i % 256];
+      Real x = b.control_[0][X_AXIS]
+               + (b.control_[3][X_AXIS] - b.control_[0][X_AXIS])
+               * Real (i % 64) / 64;
+      sum += b.get_other_coordinate (X_AXIS, x);
+    }
+  Microbench::keep (sum);
+}
+
+MICROBENCHMARK (bezier_extent)
+{
+  static vector<Bezier> curves = random_curves (256);
+  for (vsize i = 0; i < iterations; i++)
+    Microbench::keep (curves[i % 256].extent (Y_AXIS));
+}
+
+MICROBENCHMARK (transform_compose)
+{
+  static vector<Transform> transforms;
+  if (transforms.empty ())
+    {
+      std::uniform_real_distribution<Real> value (-2.0, 2.0);
+      for (vsize i = 0; i < 64; i++)
+        {
+          Transform t (Offset (value (Microbench::random ()),
+                               value (Microbench::random ())));
+          t.rotate (45 * value (Microbench::random ()), Offset (0, 0));
+          t.scale (1 + value (Microbench::random ()) / 4, 1.0);
+          transforms.push_back (t);
+        }
+    }
+  Transform t;
+  for (vsize i = 0; i < iterations; i++)
+    {
+      t.concat (transforms[i % 64]);
+      if (i % 64 == 63)
+        t = Transform ();
+    }
+  Microbench::keep (t);
+}
+
+int
+main (int argc, char **argv)
+{
+  string filter = argc > 1 ? argv[1] : "";
+  fputs (Microbench::report (Microbench::run (filter)).c_str (), stdout);
+  return 0;
+}
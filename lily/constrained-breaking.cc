@@ -25,6 +25,7 @@
 #include "page-layout-problem.hh"
 #include "paper-column.hh"
 #include "paper-score.hh"
+#include "phase-timeline.hh"
 #include "simple-spacer.hh"
 #include "system.hh"
 #include "warn.hh"
@@ -381,6 +382,8 @@ void
 Constrained_breaking::initialize (Paper_score *ps,
                                   vector<vsize> const &pagebreak_col_indices)
 {
+  Phase_timeline::Scope phase ("line-breaking");
+
   valid_systems_ = systems_ = 0;
   pscore_ = ps;
 
@@ -0,0 +1,82 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "cpu-timer.hh"
+
+#include "lily-guile.hh"
+
+#include <cstdint>
+
+static void
+end_timing_scope (void *depth)
+{
+  Cpu_timer::end_scope (static_cast<vsize> (reinterpret_cast<uintptr_t> (depth)));
+}
+
+LY_DEFINE (ly_timed_call, "ly:timed-call",
+           2, 0, 0, (SCM name, SCM thunk),
+           "Call @var{thunk}, adding the time it takes to the timing"
+           " totals of @var{name}.  Timed calls nest.")
+{
+  LY_ASSERT_TYPE (scm_is_string, name, 1);
+  LY_ASSERT_TYPE (ly_is_procedure, thunk, 2);
+
+  scm_dynwind_begin ((scm_t_dynwind_flags)0);
+  vsize depth = Cpu_timer::begin_scope (ly_scm2string (name));
+  // Also close the scope when THUNK exits non-locally.
+  scm_dynwind_unwind_handler (end_timing_scope,
+                              reinterpret_cast<void *> (uintptr_t (depth)),
+                              SCM_F_WIND_EXPLICITLY);
+  SCM result = scm_call_0 (thunk);
+  scm_dynwind_end ();
+  return result;
+}
+
+LY_DEFINE (ly_timing_totals, "ly:timing-totals",
+           0, 0, 0, (),
+           "Return the timing totals of the named scopes and processing"
+           " phases closed so far, as an alist from names to alists with"
+           " the keys @code{count}, @code{wall}, @code{cpu} and"
+           " @code{self-wall}.  Times are in seconds; @code{self-wall}"
+           " excludes nested scopes.")
+{
+  SCM totals = SCM_EOL;
+  for (auto const &entry : Cpu_timer::totals ())
+    {
+      Cpu_timer::Total const &t = entry.second;
+      SCM fields
+        = scm_list_4 (scm_cons (ly_symbol2scm ("count"),
+                                to_scm (t.count_)),
+                      scm_cons (ly_symbol2scm ("wall"), to_scm (t.wall_)),
+                      scm_cons (ly_symbol2scm ("cpu"), to_scm (t.cpu_)),
+                      scm_cons (ly_symbol2scm ("self-wall"),
+                                to_scm (t.self_wall_)));
+      totals = scm_cons (scm_cons (ly_string2scm (entry.first), fields),
+                         totals);
+    }
+  return scm_reverse_x (totals, SCM_EOL);
+}
+
+LY_DEFINE (ly_clear_timing_totals, "ly:clear-timing-totals",
+           0, 0, 0, (),
+           "Reset the timing totals of all named scopes.")
+{
+  Cpu_timer::clear_totals ();
+  return SCM_UNSPECIFIED;
+}
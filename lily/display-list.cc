@@ -0,0 +1,106 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "display-list.hh"
+
+/*
+  This must stay in sync with interpret_stencil_expression ().
+*/
+void
+Display_list::compile (SCM expr, Offset o)
+{
+  while (1)
+    {
+      if (!scm_is_pair (expr))
+        return;
+
+      SCM head = scm_car (expr);
+
+      if (scm_is_eq (head, ly_symbol2scm ("delay-stencil-evaluation")))
+        {
+          compile (scm_force (scm_cadr (expr)), o);
+          return;
+        }
+      if (scm_is_eq (head, ly_symbol2scm ("footnote")))
+        return;
+      if (scm_is_eq (head, ly_symbol2scm ("translate-stencil")))
+        {
+          o += from_scm<Offset> (scm_cadr (expr));
+          expr = scm_caddr (expr);
+        }
+      else if (scm_is_eq (head, ly_symbol2scm ("combine-stencil")))
+        {
+          for (SCM x = scm_cdr (expr); scm_is_pair (x); x = scm_cdr (x))
+            compile (scm_car (x), o);
+          return;
+        }
+      else if (scm_is_eq (head, ly_symbol2scm ("grob-cause")))
+        {
+          add (GROB_CAUSE, o, scm_cadr (expr));
+          compile (scm_caddr (expr), o);
+          add (NO_ORIGIN);
+          return;
+        }
+      else if (scm_is_eq (head, ly_symbol2scm ("color")))
+        {
+          add (SET_COLOR, o, scm_cadr (expr));
+          compile (scm_caddr (expr), o);
+          add (RESET_COLOR);
+          return;
+        }
+      else if (scm_is_eq (head, ly_symbol2scm ("output-attributes")))
+        {
+          add (START_GROUP, o, scm_cadr (expr));
+          compile (scm_caddr (expr), o);
+          add (END_GROUP);
+          return;
+        }
+      else if (scm_is_eq (head, ly_symbol2scm ("rotate-stencil")))
+        {
+          SCM args = scm_cadr (expr);
+          SCM angle = scm_car (args);
+          Offset pivot = o + from_scm (scm_cadr (args), Offset (0.0, 0.0));
+
+          add (SET_ROTATION, pivot, angle);
+          compile (scm_caddr (expr), o);
+          add (RESET_ROTATION, pivot, angle);
+          return;
+        }
+      else if (scm_is_eq (head, ly_symbol2scm ("scale-stencil")))
+        {
+          SCM args = scm_cadr (expr);
+          Offset unscaled = o.scale (Offset (1 / scm_to_double (scm_car (args)),
+                                             1 / scm_to_double (scm_cadr (args))));
+
+          add (SET_SCALE, o, args);
+          compile (scm_caddr (expr), unscaled);
+          add (RESET_SCALE);
+          return;
+        }
+      else if (scm_is_eq (head, ly_symbol2scm ("with-outline")))
+        {
+          expr = scm_caddr (expr);
+        }
+      else
+        {
+          add (PRIMITIVE, o, expr);
+          return;
+        }
+    }
+}
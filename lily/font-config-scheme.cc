@@ -106,6 +106,8 @@ LY_DEFINE (ly_font_config_get_font_file, "ly:font-config-get-font-file", 1, 0, 0
 {
   LY_ASSERT_TYPE (scm_is_string, name, 1);
 
+  init_fontconfig ();
+
   FcPattern *pat = FcPatternCreate ();
   FcValue val;
 
@@ -133,6 +135,8 @@ LY_DEFINE (ly_font_config_display_fonts, "ly:font-config-display-fonts", 0, 0, 0
            (),
            "Dump a list of all fonts visible to FontConfig.")
 {
+  init_fontconfig ();
+
   string str = display_list (NULL);
   str += display_config (NULL);
 
@@ -147,6 +151,8 @@ LY_DEFINE (ly_font_config_add_directory, "ly:font-config-add-directory", 1, 0, 0
 {
   LY_ASSERT_TYPE (scm_is_string, dir, 1);
 
+  init_fontconfig ();
+
   string d = ly_scm2string (dir);
 
   if (!FcConfigAppFontAddDir (0, (const FcChar8 *)d.c_str ()))
@@ -163,6 +169,8 @@ LY_DEFINE (ly_font_config_add_font, "ly:font-config-add-font", 1, 0, 0,
 {
   LY_ASSERT_TYPE (scm_is_string, font, 1);
 
+  init_fontconfig ();
+
   string f = ly_scm2string (font);
 
   if (!FcConfigAppFontAddFile (0, (const FcChar8 *)f.c_str ()))
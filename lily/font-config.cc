@@ -21,6 +21,7 @@
 
 #if HAVE_FONTCONFIG
 
+#include "cpu-timer.hh"
 #include "file-path.hh"
 #include "international.hh"
 #include "main.hh"
@@ -35,17 +36,41 @@ using std::vector;
 
 FcConfig *font_config_global = 0;
 
+/*
+  Set up FontConfig with LilyPond's configuration and fonts.  This is
+  only needed for text fonts, so it is done on first use rather than
+  at startup.
+*/
 void
 init_fontconfig ()
 {
+  if (font_config_global)
+    return;
+
+  Cpu_timer::Scope scope ("fontconfig-init");
   debug_output (_ ("Initializing FontConfig..."));
 
-  /* TODO: Find a way for Fontconfig to update its cache, if needed. */
   FcInitLoadConfig ();
 
   /* Create an empty configuration */
   font_config_global = FcConfigCreate ();
 
+#if FC_VERSION >= 21205
+  /* Keep the cache for our own font directory next to it, so it is
+     built once instead of on every run.  Since it comes first,
+     fontconfig also writes new caches here if the directory is
+     writable, and falls back to the default locations otherwise.  */
+  string cache_dir = lilypond_datadir + "/fonts/cache";
+  string cache_conf = "<?xml version=\"1.0\"?>\n"
+                      "<fontconfig><cachedir>" + cache_dir
+                      + "</cachedir></fontconfig>\n";
+  if (FcConfigParseAndLoadFromMemory (font_config_global,
+                                      (const FcChar8 *) cache_conf.c_str (),
+                                      FcFalse))
+    debug_output (_f ("Using fontconfig cache directory: %s",
+                      cache_dir.c_str ()));
+#endif
+
   /* fontconfig conf files */
   vector<string> confs;
 
@@ -91,8 +116,8 @@ init_fontconfig ()
   FcConfigBuildFonts (font_config_global);
   FcConfigSetCurrent (font_config_global);
 
-  debug_output ("\n");
-
+  debug_output (_f ("FontConfig initialized in %.2f seconds",
+                    scope.wall ()));
 }
 
 #else
@@ -0,0 +1,344 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "font-metric-cache.hh"
+
+#include "file-name.hh"
+#include "file-path.hh"
+#include "international.hh"
+#include "lily-guile.hh"
+#include "open-type-font.hh"
+#include "program-option.hh"
+#include "string-convert.hh"
+#include "warn.hh"
+
+#include <cstdint>
+#include <cstdio>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using std::string;
+
+/* Bump this when changing the layout of the cache file. */
+static const uint32_t cache_format_version = 1;
+static const char cache_magic[] = "LYFMC\n";
+
+/*
+  Binary I/O in host byte order; the cache is never shared between
+  machines.
+*/
+static void
+write_u32 (FILE *f, uint32_t x)
+{
+  fwrite (&x, sizeof (x), 1, f);
+}
+
+static void
+write_real (FILE *f, Real x)
+{
+  fwrite (&x, sizeof (x), 1, f);
+}
+
+static void
+write_string (FILE *f, string const &s)
+{
+  write_u32 (f, static_cast<uint32_t> (s.size ()));
+  fwrite (s.data (), 1, s.size (), f);
+}
+
+static void
+write_box (FILE *f, Box const &b)
+{
+  for (const auto a : {X_AXIS, Y_AXIS})
+    for (const auto d : {LEFT, RIGHT})
+      write_real (f, b[a][d]);
+}
+
+static bool
+read_u32 (FILE *f, uint32_t *x)
+{
+  return fread (x, sizeof (*x), 1, f) == 1;
+}
+
+static bool
+read_real (FILE *f, Real *x)
+{
+  return fread (x, sizeof (*x), 1, f) == 1;
+}
+
+/* Check the length against FILE_SIZE before allocating, so a corrupt
+   file cannot make us allocate gigabytes. */
+static bool
+read_string (FILE *f, long file_size, string *s)
+{
+  uint32_t len;
+  if (!read_u32 (f, &len) || long (len) > file_size - ftell (f))
+    return false;
+  s->resize (len);
+  return len == 0 || fread (&(*s)[0], 1, len, f) == len;
+}
+
+static bool
+read_box (FILE *f, Box *b)
+{
+  for (const auto a : {X_AXIS, Y_AXIS})
+    for (const auto d : {LEFT, RIGHT})
+      if (!read_real (f, &(*b)[a][d]))
+        return false;
+  return true;
+}
+
+Font_metric_cache::Font_metric_cache ()
+{
+  filled_ = false;
+}
+
+/* FNV-1a; stable across runs and builds, unlike std::hash. */
+static uint32_t
+path_hash (string const &s)
+{
+  uint32_t h = 2166136261u;
+  for (unsigned char c : s)
+    {
+      h ^= c;
+      h *= 16777619u;
+    }
+  return h;
+}
+
+/*
+  Font files of the same name in different directories must not share
+  a cache file, so the name includes a hash of the full path.
+*/
+string
+Font_metric_cache::cache_file_name (string const &font_file,
+                                    FT_Long face_index,
+                                    char const *extension) const
+{
+  SCM dir = ly_get_option (ly_symbol2scm ("font-metric-cache"));
+  if (scm_is_symbol (dir))
+    dir = scm_symbol_to_string (dir);
+  if (!scm_is_string (dir))
+    return "";
+
+  File_name font_name (font_file);
+  return ly_scm2string (dir) + "/" + font_name.base_ + "-"
+         + String_convert::int_string (static_cast<int> (face_index)) + "-"
+         + String_convert::unsigned2hex (path_hash (font_file), 8, '0')
+         + extension;
+}
+
+bool
+Font_metric_cache::fill (string const &font_file, FT_Long face_index,
+                         FT_Face face)
+{
+  if (!load (font_file, face_index, face, true))
+    return false;
+
+  index_names ();
+  filled_ = true;
+  return true;
+}
+
+bool
+Font_metric_cache::fill_charcode_map (string const &font_file,
+                                      FT_Long face_index, FT_Face face)
+{
+  return load (font_file, face_index, face, false);
+}
+
+bool
+Font_metric_cache::load (string const &font_file, FT_Long face_index,
+                         FT_Face face, bool with_glyphs)
+{
+  string cache_file = cache_file_name (font_file, face_index,
+                                       with_glyphs ? ".lymc" : ".lycm");
+  if (cache_file.empty ())
+    return false;
+
+  struct stat st;
+  if (stat (font_file.c_str (), &st) != 0)
+    return false;
+
+  string key = font_file + ":"
+               + String_convert::int_string (static_cast<int> (face_index))
+               + ":" + std::to_string (static_cast<long long> (st.st_size))
+               + ":" + std::to_string (static_cast<long long> (st.st_mtime));
+
+  if (!read (cache_file, key, face))
+    {
+      debug_output (_f ("Building font metric cache %s",
+                        cache_file.c_str ()));
+      if (with_glyphs)
+        build (face);
+      else
+        index_to_charcode_map_ = make_index_to_charcode_map (face);
+      write (cache_file, key);
+    }
+
+  return true;
+}
+
+bool
+Font_metric_cache::read (string const &cache_file, string const &key,
+                         FT_Face face)
+{
+  FILE *f = fopen (cache_file.c_str (), "rb");
+  if (!f)
+    return false;
+
+  struct stat st;
+  long size = fstat (fileno (f), &st) == 0 ? long (st.st_size) : 0;
+  bool ok = true;
+  string magic;
+  string file_key;
+  uint32_t version = 0;
+  uint32_t real_size = 0;
+  uint32_t glyph_count = 0;
+  ok = ok && read_string (f, size, &magic) && magic == cache_magic;
+  ok = ok && read_u32 (f, &version) && version == cache_format_version;
+  ok = ok && read_u32 (f, &real_size) && real_size == sizeof (Real);
+  ok = ok && read_string (f, size, &file_key) && file_key == key;
+  ok = ok && read_u32 (f, &glyph_count)
+       && FT_Long (glyph_count) <= face->num_glyphs;
+
+  if (ok)
+    glyphs_.resize (glyph_count);
+  for (uint32_t i = 0; ok && i < glyph_count; i++)
+    {
+      Glyph &g = glyphs_[i];
+      ok = read_string (f, size, &g.name_)
+           && read_box (f, &g.dimensions_)
+           && read_box (f, &g.outline_bbox_);
+    }
+
+  uint32_t charcode_count = 0;
+  ok = ok && read_u32 (f, &charcode_count)
+       && FT_Long (charcode_count) <= face->num_glyphs;
+  for (uint32_t i = 0; ok && i < charcode_count; i++)
+    {
+      uint32_t idx = 0;
+      uint32_t code = 0;
+      ok = read_u32 (f, &idx) && read_u32 (f, &code);
+      if (ok)
+        index_to_charcode_map_[idx] = code;
+    }
+
+  fclose (f);
+  if (!ok)
+    {
+      debug_output (_f ("Ignoring stale font metric cache %s",
+                        cache_file.c_str ()));
+      glyphs_.clear ();
+      index_to_charcode_map_.clear ();
+    }
+  return ok;
+}
+
+void
+Font_metric_cache::write (string const &cache_file, string const &key) const
+{
+  /* Write to a private file first, so concurrent runs never see a
+     partial cache. */
+  string tmp_file = cache_file + "." + std::to_string (getpid ());
+  FILE *f = fopen (tmp_file.c_str (), "wb");
+  if (!f)
+    {
+      warning (_f ("cannot write font metric cache: %s",
+                   cache_file.c_str ()));
+      return;
+    }
+
+  write_string (f, cache_magic);
+  write_u32 (f, cache_format_version);
+  write_u32 (f, static_cast<uint32_t> (sizeof (Real)));
+  write_string (f, key);
+
+  write_u32 (f, static_cast<uint32_t> (glyphs_.size ()));
+  for (Glyph const &g : glyphs_)
+    {
+      write_string (f, g.name_);
+      write_box (f, g.dimensions_);
+      write_box (f, g.outline_bbox_);
+    }
+
+  write_u32 (f, static_cast<uint32_t> (index_to_charcode_map_.size ()));
+  for (auto const &entry : index_to_charcode_map_)
+    {
+      write_u32 (f, static_cast<uint32_t> (entry.first));
+      write_u32 (f, static_cast<uint32_t> (entry.second));
+    }
+
+  bool ok = !ferror (f);
+  ok = (fclose (f) == 0) && ok;
+  if (!ok || !rename_file (tmp_file.c_str (), cache_file.c_str ()))
+    {
+      warning (_f ("cannot write font metric cache: %s",
+                   cache_file.c_str ()));
+      remove (tmp_file.c_str ());
+    }
+}
+
+void
+Font_metric_cache::build (FT_Face face)
+{
+  glyphs_.resize (face->num_glyphs);
+  for (FT_Long i = 0; i < face->num_glyphs; i++)
+    {
+      Glyph &g = glyphs_[i];
+
+      const size_t len = 256;
+      char name[len];
+      FT_Error code = FT_Get_Glyph_Name (face, FT_UInt (i), name, FT_UInt (len));
+      if (code)
+        warning (_f ("FT_Get_Glyph_Name () error: %s",
+                     freetype_error_string (code).c_str ()));
+      else
+        g.name_ = name;
+
+      g.dimensions_ = ly_FT_get_unscaled_indexed_char_dimensions (face, i);
+      g.outline_bbox_ = ly_FT_get_glyph_outline_bbox (face, i);
+    }
+
+  index_to_charcode_map_ = make_index_to_charcode_map (face);
+}
+
+void
+Font_metric_cache::index_names ()
+{
+  name_to_index_.clear ();
+  /* Like FT_Get_Name_Index: the first glyph of a name wins, and
+     glyph 0 (.notdef) is never found by name. */
+  for (vsize i = 1; i < glyphs_.size (); i++)
+    if (!glyphs_[i].name_.empty ())
+      name_to_index_.emplace (glyphs_[i].name_, i);
+}
+
+Font_metric_cache::Glyph const *
+Font_metric_cache::glyph (size_t idx) const
+{
+  return idx < glyphs_.size () ? &glyphs_[idx] : nullptr;
+}
+
+size_t
+Font_metric_cache::name_to_index (string const &name) const
+{
+  auto it = name_to_index_.find (name);
+  return it != name_to_index_.end () ? it->second : GLYPH_INDEX_INVALID;
+}
@@ -27,6 +27,7 @@
 #include "lily-guile.hh"
 #include "main.hh"
 #include "misc.hh"
+#include "output-cache.hh"
 #include "program-option.hh"
 #include "relocate.hh"
 #include "string-convert.hh"
@@ -104,6 +105,18 @@ LY_DEFINE (ly_rename_file, "ly:rename-file",
   return SCM_UNSPECIFIED;
 }
 
+LY_DEFINE (ly_note_output_file, "ly:note-output-file",
+           1, 0, 0, (SCM name),
+           "Record that the output file @var{name} was written, so that"
+           " @code{-doutput-cache} can reuse it.  Files written through"
+           " a paper outputter are recorded automatically.")
+{
+  LY_ASSERT_TYPE (scm_is_string, name, 1);
+
+  Output_cache::note_output (ly_scm2string (name));
+  return SCM_UNSPECIFIED;
+}
+
 LY_DEFINE (ly_randomize_rand_seed, "ly:randomize-rand-seed", 0, 0, 0, (),
            "Randomize C random generator.")
 {
@@ -501,7 +514,7 @@ LY_DEFINE (ly_truncate_list_x, "ly:truncate-list!",
 }
 
 string
-format_single_argument (SCM arg, int precision, bool escape = false)
+format_single_argument (SCM arg, int precision, bool escape)
 {
   if (scm_is_integer (arg) && scm_is_true (scm_exact_p (arg)))
     return (String_convert::int_string (scm_to_int (arg)));
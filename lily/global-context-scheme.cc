@@ -25,6 +25,7 @@
 #include "music-output.hh"
 #include "music.hh"
 #include "output-def.hh"
+#include "phase-timeline.hh"
 #include "translator-group.hh"
 #include "warn.hh"
 
@@ -97,6 +98,7 @@ LY_DEFINE (ly_interpret_music_expression, "ly:interpret-music-expression",
 
   Global_context *g = unsmob<Global_context> (ctx);
 
+  Phase_timeline::Scope phase ("translation");
   Cpu_timer timer;
 
   message (_ ("Interpreting music..."));
@@ -117,7 +119,7 @@ LY_DEFINE (ly_interpret_music_expression, "ly:interpret-music-expression",
 
   send_stream_event (g, "Finish", 0);
 
-  debug_output (_f ("elapsed time: %.2f seconds", timer.read ()));
+  debug_output (_f ("elapsed time: %.2f seconds", timer.wall ()));
 
   return ctx;
 }
@@ -25,6 +25,7 @@
 #include "music-iterator.hh"
 #include "music.hh"
 #include "output-def.hh"
+#include "trace.hh"
 #include "warn.hh"
 
 #include <cstdio>
@@ -147,6 +148,8 @@ Global_context::run_iterator_on_me (Music_iterator *iter)
           break;
         }
 
+      Trace::Scope trace (Trace::TRANSLATION, "timestep",
+                          static_cast<double> (w.main_part_));
       send_stream_event (this, "Prepare", 0,
                          ly_symbol2scm ("moment"), w.smobbed_copy ());
 
@@ -35,6 +35,7 @@
 #include "unpure-pure-container.hh"
 #include "warn.hh"
 #include "protected-scm.hh"
+#include "trace.hh"
 
 #include <cstring>
 
@@ -120,9 +121,21 @@ Grob::get_property_alist_chain (SCM def) const
 
 extern void check_interfaces_for_property (Grob const *me, SCM sym);
 
+/* Pure callbacks may read any property or object of the grob, so a
+   change to either invalidates what we remembered about their values.
+   The in-progress marker is set around every pure Y-offset evaluation
+   and does not count as a change. */
+void
+Grob::flush_pure_cache_for (SCM sym)
+{
+  if (!scm_is_eq (sym, ly_symbol2scm ("pure-Y-offset-in-progress")))
+    flush_pure_cache ();
+}
+
 void
 Grob::internal_set_property (SCM sym, SCM v)
 {
+  flush_pure_cache_for (sym);
   internal_set_value_on_alist (&mutable_property_alist_,
                                sym, v);
 
@@ -226,6 +239,17 @@ Grob::internal_get_pure_property (SCM sym, vsize start, vsize end) const
   return val;
 }
 
+/* Whether the pure value of SYM may depend on the column range, so that
+   remembering it per (start, end) pays off. */
+bool
+Grob::has_ranged_pure_callback (SCM sym) const
+{
+  SCM val = internal_get_property_data (sym);
+  if (Unpure_pure_container *upc = unsmob<Unpure_pure_container> (val))
+    return !upc->is_unchanging ();
+  return false;
+}
+
 SCM
 Grob::internal_get_maybe_pure_property (SCM sym, bool pure,
                                         vsize start, vsize end) const
@@ -250,7 +274,10 @@ Grob::try_callback_on_alist (SCM *alist, SCM sym, SCM proc)
 
   SCM value = SCM_EOL;
   if (ly_is_procedure (proc))
-    value = scm_call_1 (proc, self_scm ());
+    {
+      Trace::Scope trace (Trace::CALLBACK, sym, this);
+      value = scm_call_1 (proc, self_scm ());
+    }
 
 #ifdef DEBUG
   if (debug_property_callbacks)
@@ -295,15 +322,73 @@ Grob::internal_set_object (SCM s, SCM v)
   if (!is_live ())
     return;
 
+  flush_pure_cache_for (s);
   object_alist_ = scm_assq_set_x (object_alist_, s, v);
 }
 
 void
 Grob::internal_del_property (SCM sym)
 {
+  flush_pure_cache_for (sym);
   mutable_property_alist_ = scm_assq_remove_x (mutable_property_alist_, sym);
 }
 
+vsize Grob::pure_cache_hits_ = 0;
+vsize Grob::pure_cache_misses_ = 0;
+vsize Grob::pure_cycles_ = 0;
+
+// The pure property cache is indexed by (name start . end), where name is
+// a symbol, and start and end are numbers referring to the starting and
+// ending column ranks of the current line.
+static SCM
+make_pure_property_cache_key (SCM sym, vsize start, vsize end)
+{
+  return scm_cons2 (sym, to_scm (start), to_scm (end));
+}
+
+SCM
+Grob::get_cached_pure_property (SCM sym, vsize start, vsize end)
+{
+  if (SCM_UNBNDP (pure_property_cache_))
+    {
+      pure_cache_misses_++;
+      return SCM_UNDEFINED;
+    }
+
+  SCM val = scm_hash_ref (pure_property_cache_,
+                          make_pure_property_cache_key (sym, start, end),
+                          SCM_UNDEFINED);
+  if (SCM_UNBNDP (val))
+    pure_cache_misses_++;
+  else
+    pure_cache_hits_++;
+  return val;
+}
+
+void
+Grob::cache_pure_property (SCM sym, vsize start, vsize end, SCM val)
+{
+  if (SCM_UNBNDP (pure_property_cache_))
+    pure_property_cache_ = scm_c_make_hash_table (17);
+
+  scm_hash_set_x (pure_property_cache_,
+                  make_pure_property_cache_key (sym, start, end),
+                  val);
+}
+
+void
+Grob::report_pure_cache_statistics ()
+{
+  vsize total = pure_cache_hits_ + pure_cache_misses_;
+  if (total)
+    ::debug_output (_f ("pure property cache: %zu hits, %zu misses (%.1f%%)",
+                        pure_cache_hits_, pure_cache_misses_,
+                        100.0 * static_cast<Real> (pure_cache_hits_)
+                        / static_cast<Real> (total)));
+  pure_cache_hits_ = 0;
+  pure_cache_misses_ = 0;
+}
+
 SCM
 Grob::internal_get_object (SCM sym) const
 {
@@ -44,6 +44,7 @@ Grob::mark_smob () const
   derived_mark ();
   scm_gc_mark (object_alist_);
   scm_gc_mark (interfaces_);
+  scm_gc_mark (pure_property_cache_);
 
   return mutable_property_alist_;
 }
@@ -45,8 +45,11 @@ using std::set;
 using std::string;
 using std::vector;
 
+vsize Grob::count_ = 0;
+
 Grob::Grob (SCM basicprops)
 {
+  count_++;
 
   /* FIXME: default should be no callback.  */
   layout_ = 0;
@@ -55,6 +58,7 @@ Grob::Grob (SCM basicprops)
   immutable_property_alist_ = basicprops;
   mutable_property_alist_ = SCM_EOL;
   object_alist_ = SCM_EOL;
+  pure_property_cache_ = SCM_UNDEFINED;
 
   /* We do smobify_self () as the first step.  Since the object lives
      on the heap, none of its SCM variables are protected from
@@ -93,6 +97,7 @@ Grob::Grob (SCM basicprops)
 Grob::Grob (Grob const &s)
   : Smob<Grob> ()
 {
+  count_++;
   original_ = (Grob *) & s;
 
   immutable_property_alist_ = s.immutable_property_alist_;
@@ -103,6 +108,7 @@ Grob::Grob (Grob const &s)
 
   interfaces_ = s.interfaces_;
   object_alist_ = SCM_EOL;
+  pure_property_cache_ = SCM_UNDEFINED;
 
   layout_ = 0;
 
@@ -113,6 +119,7 @@ Grob::Grob (Grob const &s)
 
 Grob::~Grob ()
 {
+  count_--;
 }
 /****************************************************************
   STENCILS
@@ -284,6 +291,43 @@ Grob::suicide ()
   interfaces_ = SCM_EOL;
 }
 
+/*
+  Stencils still refer to their grob through grob-cause, which looks
+  up the cause for point-and-click and asks for the grob's own X and Y
+  extents.  Compute those while the grobs they depend on still have
+  their layout data; the dimension cache keeps them afterwards.  Only
+  grobs with a stencil can show up in the output.
+*/
+void
+Grob::cache_output_extents ()
+{
+  if (is_live ()
+      && scm_is_pair (scm_assq (ly_symbol2scm ("cause"),
+                                mutable_property_alist_))
+      && scm_is_pair (scm_assq (ly_symbol2scm ("stencil"),
+                                mutable_property_alist_)))
+    {
+      extent (this, X_AXIS);
+      extent (this, Y_AXIS);
+    }
+}
+
+/*
+  Keep the cause and the dimension cache, which grob-cause needs.
+*/
+void
+Grob::release_layout ()
+{
+  if (!is_live ())
+    return;
+
+  SCM cause = scm_assq (ly_symbol2scm ("cause"), mutable_property_alist_);
+  mutable_property_alist_ = scm_is_pair (cause) ? scm_list_1 (cause)
+                            : SCM_EOL;
+  object_alist_ = SCM_EOL;
+  pure_property_cache_ = SCM_UNDEFINED;
+}
+
 void
 Grob::handle_prebroken_dependencies ()
 {
@@ -358,22 +402,38 @@ Grob::pure_relative_y_coordinate (Grob const *refp, vsize start, vsize end)
   if (dim_cache_[Y_AXIS].offset_)
     {
       if (from_scm<bool> (get_property (this, "pure-Y-offset-in-progress")))
-        programming_error ("cyclic chain in pure-Y-offset callbacks");
+        {
+          programming_error ("cyclic chain in pure-Y-offset callbacks");
+          pure_cycles_++;
+        }
 
       off = *dim_cache_[Y_AXIS].offset_;
     }
   else
     {
-      SCM proc = get_property_data (this, "Y-offset");
-
-      dim_cache_[Y_AXIS].offset_ = 0;
-      set_property (this, "pure-Y-offset-in-progress", SCM_BOOL_T);
-      off = from_scm<double> (call_pure_function (proc,
-                                                   scm_list_1 (self_scm ()),
-                                                   start, end),
-                               0.0);
-      del_property (this, "pure-Y-offset-in-progress");
-      dim_cache_[Y_AXIS].offset_.reset ();
+      SCM sym = ly_symbol2scm ("Y-offset");
+      bool cacheable = has_ranged_pure_callback (sym);
+      SCM cached = cacheable
+                   ? get_cached_pure_property (sym, start, end)
+                   : SCM_UNDEFINED;
+      if (scm_is_number (cached))
+        off = from_scm<double> (cached);
+      else
+        {
+          vsize cycles = pure_cycles_;
+          SCM proc = get_property_data (this, "Y-offset");
+
+          dim_cache_[Y_AXIS].offset_ = 0;
+          set_property (this, "pure-Y-offset-in-progress", SCM_BOOL_T);
+          off = from_scm<double> (call_pure_function (proc,
+                                                       scm_list_1 (self_scm ()),
+                                                       start, end),
+                                   0.0);
+          del_property (this, "pure-Y-offset-in-progress");
+          dim_cache_[Y_AXIS].offset_.reset ();
+          if (cacheable && cycles == pure_cycles_)
+            cache_pure_property (sym, start, end, to_scm (off));
+        }
     }
 
   /* we simulate positioning-done if we are the child of a VerticalAlignment,
@@ -492,7 +552,20 @@ Grob::extent (Grob const *refp, Axis a) const
 Interval
 Grob::pure_y_extent (Grob *refp, vsize start, vsize end)
 {
-  SCM iv_scm = get_pure_property (this, "Y-extent", start, end);
+  /* Only callbacks that depend on the line's column range are worth
+     remembering; the rest are cheap or already cached in the alist. */
+  SCM sym = ly_symbol2scm ("Y-extent");
+  bool cacheable = has_ranged_pure_callback (sym);
+  SCM iv_scm = cacheable
+               ? get_cached_pure_property (sym, start, end)
+               : SCM_UNDEFINED;
+  if (SCM_UNBNDP (iv_scm))
+    {
+      vsize cycles = pure_cycles_;
+      iv_scm = get_pure_property (this, "Y-extent", start, end);
+      if (cacheable && cycles == pure_cycles_)
+        cache_pure_property (sym, start, end, iv_scm);
+    }
   Interval iv = from_scm (iv_scm, Interval ());
   Real offset = pure_relative_y_coordinate (refp, start, end);
 
@@ -728,11 +801,18 @@ Grob::origin () const
 
 string
 Grob::name () const
+{
+  SCM nm = name_symbol ();
+  return scm_is_symbol (nm) ? ly_symbol2string (nm) : class_name ();
+}
+
+SCM
+Grob::name_symbol () const
 {
   SCM meta = get_property (this, "meta");
   SCM nm = scm_assq (ly_symbol2scm ("name"), meta);
   nm = (scm_is_pair (nm)) ? scm_cdr (nm) : SCM_EOL;
-  return scm_is_symbol (nm) ? ly_symbol2string (nm) : class_name ();
+  return scm_is_symbol (nm) ? nm : SCM_BOOL_F;
 }
 
 ADD_INTERFACE (Grob,
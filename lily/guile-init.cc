@@ -70,7 +70,7 @@ ly_init_ly_module ()
     }
 
   scm_primitive_load_path (scm_from_ascii_string ("lily.scm"));
-  debug_output (_f ("Load lily.scm: %.2f seconds", timer.read ()));
+  debug_output (_f ("Load lily.scm: %.2f seconds", timer.wall ()));
 }
 
 void
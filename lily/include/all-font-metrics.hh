@@ -43,6 +43,7 @@ class All_font_metrics : public Smob<All_font_metrics>
   std::map<std::string, Index_to_charcode_map > filename_charcode_maps_map_;
 
   All_font_metrics (All_font_metrics const &);
+  PangoFT2FontMap *pango_font_map ();
 public:
   SCM mark_smob () const;
 
@@ -54,6 +54,7 @@ class Axis_group_interface
                                                      Grob *common, Axis, bool);
   static Interval relative_pure_height (Grob *me, int start, int end);
   static Interval combine_pure_heights (Grob *me, SCM, vsize, vsize);
+  static vsize previous_break_rank (Grob *me, vsize start, vsize end);
   static Interval sum_partial_pure_heights (Grob *me, int, int);
   static Interval begin_of_line_pure_height (Grob *me, vsize);
   static Interval rest_of_line_pure_height (Grob *me, vsize, vsize);
@@ -21,8 +21,7 @@
 #ifndef BEAM_SCORING_PROBLEM_HH
 #define BEAM_SCORING_PROBLEM_HH
 
-#include <memory>
-
+#include "arena.hh"
 #include "beam.hh"
 #include "interval.hh"
 #include "lily-guile.hh"
@@ -59,8 +58,8 @@ public:
   Beam_configuration ();
   bool done () const;
   void add (Real demerit, const std::string &reason);
-  static std::unique_ptr<Beam_configuration> new_config (Drul_array<Real> start,
-                                                         Drul_array<Real> offset);
+  static Beam_configuration new_config (Drul_array<Real> start,
+                                        Drul_array<Real> offset);
 };
 
 // Comparator for a queue of Beam_configuration*.
@@ -187,8 +186,7 @@ private:
   void one_scorer (Beam_configuration *config) const;
   Beam_configuration *
   force_score (SCM inspect_quants,
-               const std::vector<std::unique_ptr<Beam_configuration>> &configs)
-  const;
+               const std::vector<Beam_configuration *> &configs) const;
   Real y_at (Real x, Beam_configuration const *c) const;
 
   // Scoring functions:
@@ -198,9 +196,8 @@ private:
   void score_slope_direction (Beam_configuration *config) const;
   void score_slope_musical (Beam_configuration *config) const;
   void score_stem_lengths (Beam_configuration *config) const;
-  void
-  generate_quants (std::vector<std::unique_ptr<Beam_configuration>> *scores)
-  const;
+  void generate_quants (Arena<Beam_configuration> *arena,
+                        std::vector<Beam_configuration *> *scores) const;
   void score_collisions (Beam_configuration *config) const;
 };
 
@@ -0,0 +1,83 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef DISPLAY_LIST_HH
+#define DISPLAY_LIST_HH
+
+#include "lily-guile.hh"
+#include "offset.hh"
+#include "std-vector.hh"
+
+/*
+  A stencil expression flattened into a sequence of output commands.
+
+  The nesting of combine-stencil and translate-stencil is resolved
+  into absolute offsets at compile time, so that replaying the list
+  does not walk the expression tree again.  The commands correspond
+  one-to-one with those that interpret_stencil_expression () sends to
+  its sink.
+
+  The list does not protect the SCM values it refers to; they are all
+  part of the stencil expression it was compiled from, which must be
+  kept alive while the list is in use.
+*/
+class Display_list
+{
+public:
+  enum Command
+  {
+    PRIMITIVE,          // expr_ at offset_
+    GROB_CAUSE,         // grob expr_ at offset_
+    NO_ORIGIN,
+    SET_COLOR,          // color expr_: a string or a list of 3 or 4 numbers
+    RESET_COLOR,
+    START_GROUP,        // attributes expr_
+    END_GROUP,
+    SET_ROTATION,       // angle expr_ around offset_
+    RESET_ROTATION,     // angle expr_ around offset_
+    SET_SCALE,          // scale factors expr_
+    RESET_SCALE,
+  };
+
+  struct Item
+  {
+    Command command_;
+    Offset offset_;
+    SCM expr_;
+
+    Item (Command c, Offset o, SCM e)
+      : command_ (c), offset_ (o), expr_ (e)
+    {
+    }
+  };
+
+  void compile (SCM expr, Offset o);
+  std::vector<Item> const &items () const { return items_; }
+  void clear () { items_.clear (); }
+
+private:
+  void add (Command c, Offset o = Offset (), SCM e = SCM_UNDEFINED)
+  {
+    items_.push_back (Item (c, o, e));
+  }
+
+  std::vector<Item> items_;
+};
+
+#endif /* DISPLAY_LIST_HH */
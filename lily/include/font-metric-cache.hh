@@ -0,0 +1,87 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FONT_METRIC_CACHE_HH
+#define FONT_METRIC_CACHE_HH
+
+#include "box.hh"
+#include "font-metric.hh"
+#include "freetype.hh"
+
+#include <unordered_map>
+
+/*
+  The data of a font face that we otherwise recompute with FreeType
+  in every run: glyph names, the index to charcode map and the
+  unscaled glyph boxes.
+
+  With -dfont-metric-cache=DIR, this is stored in a file in DIR.  The
+  file records the name, size and modification time of the font file,
+  and is rebuilt when any of them changes.
+*/
+class Font_metric_cache
+{
+public:
+  struct Glyph
+  {
+    std::string name_;
+    Box dimensions_;
+    Box outline_bbox_;
+  };
+
+private:
+  std::vector<Glyph> glyphs_;
+  std::unordered_map<std::string, size_t> name_to_index_;
+  Index_to_charcode_map index_to_charcode_map_;
+  bool filled_;
+
+  std::string cache_file_name (std::string const &font_file,
+                               FT_Long face_index,
+                               char const *extension) const;
+  bool load (std::string const &font_file, FT_Long face_index,
+             FT_Face face, bool with_glyphs);
+  bool read (std::string const &cache_file, std::string const &key,
+             FT_Face face);
+  void write (std::string const &cache_file, std::string const &key) const;
+  void build (FT_Face face);
+  void index_names ();
+
+public:
+  Font_metric_cache ();
+
+  // Load the data for FACE, read from FONT_FILE, or compute and store
+  // it.  Return false if the cache is not enabled.
+  bool fill (std::string const &font_file, FT_Long face_index, FT_Face face);
+  // Like fill, but only load or store the index to charcode map, for
+  // faces whose glyphs are measured by Pango.
+  bool fill_charcode_map (std::string const &font_file, FT_Long face_index,
+                          FT_Face face);
+  bool is_filled () const { return filled_; }
+
+  // Return null if IDX is not a glyph of the face.
+  Glyph const *glyph (size_t idx) const;
+  size_t name_to_index (std::string const &name) const;
+  size_t glyph_count () const { return glyphs_.size (); }
+  Index_to_charcode_map const &index_to_charcode_map () const
+  {
+    return index_to_charcode_map_;
+  }
+};
+
+#endif /* FONT_METRIC_CACHE_HH */
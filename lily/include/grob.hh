@@ -52,6 +52,10 @@ protected:
   SCM mutable_property_alist_;
   SCM object_alist_;
 
+  /* Pure values indexed by (symbol start . end); see
+     get_cached_pure_property ().  */
+  SCM pure_property_cache_;
+
   /*
     If this is a property, it accounts for 25% of the property
     lookups.
@@ -63,6 +67,14 @@ protected:
   SCM try_callback (SCM, SCM);
   SCM try_callback_on_alist (SCM *, SCM, SCM);
   void internal_set_value_on_alist (SCM *alist, SCM sym, SCM val);
+  void flush_pure_cache_for (SCM sym);
+  bool has_ranged_pure_callback (SCM sym) const;
+
+  static vsize pure_cache_hits_;
+  static vsize pure_cache_misses_;
+  /* Times a cyclic pure Y-offset evaluation used a placeholder; values
+     computed meanwhile are not cached.  */
+  static vsize pure_cycles_;
 
   /* messages */
   Input *origin () const override;
@@ -101,12 +113,22 @@ public:
   Grob (Grob const &);
   virtual Grob *clone () const = 0;
 
+  /* Number of grobs in memory. */
+  static vsize count_;
+
   /* forced death */
   void suicide ();
   bool is_live () const;
 
+  /* Drop the data only needed for layout, once stencils are made.
+     Call cache_output_extents () on all grobs of the system first.  */
+  void cache_output_extents ();
+  void release_layout ();
+
   /* naming. */
   std::string name () const;
+  // The name symbol from the meta property, or #f.
+  SCM name_symbol () const;
 
   /* Properties */
   SCM get_property_alist_chain (SCM) const;
@@ -122,6 +144,12 @@ public:
   void instrumented_set_property (SCM, SCM, char const *, int, char const *);
   void internal_set_property (SCM sym, SCM val);
 
+  /* pure property cache */
+  SCM get_cached_pure_property (SCM sym, vsize start, vsize end);
+  void cache_pure_property (SCM sym, vsize start, vsize end, SCM value);
+  static void report_pure_cache_statistics ();
+  void flush_pure_cache () { pure_property_cache_ = SCM_UNDEFINED; }
+
   /* causes */
   Stream_event *event_cause () const;
   Stream_event *ultimate_event_cause () const;
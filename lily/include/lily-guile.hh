@@ -60,6 +60,7 @@ SCM ly_string2scm (std::string const &s);
 std::string ly_scm2string (SCM s);
 std::string ly_symbol2string (SCM);
 std::string robust_symbol2string (SCM, const std::string &);
+std::string format_single_argument (SCM arg, int precision, bool escape = false);
 SCM ly_chain_assoc (SCM key, SCM achain);
 SCM ly_chain_assoc_get (SCM key, SCM achain, SCM default_value, SCM strict_checking = SCM_BOOL_F);
 
@@ -94,6 +94,9 @@ extern Variable make_music;
 extern Variable make_safe_lilypond_module;
 extern Variable make_span_event;
 extern Variable markup_p;
+extern Variable markup_cache_key;
+extern Variable markup_cache_ref;
+extern Variable markup_cache_set_x;
 extern Variable markup_command_signature;
 extern Variable markup_function_p;
 extern Variable markup_list_function_p;
@@ -54,6 +54,7 @@ class Context_def;
 class Context_mod;
 class Context_specced_music;
 class Dispatcher;
+class Display_list;
 class Dot_column;
 class Dot_configuration;
 class Dot_formatting_problem;
@@ -151,6 +152,7 @@ class Skyline;
 class Skyline_pair;
 class Slur_configuration;
 class Slur_score_state;
+class Smob_census;
 class Source_file;
 class Sources;
 class Spacing_options;
@@ -29,6 +29,7 @@ void do_scores ();
 void clear_scores ();
 void add_score (Score *s);
 void call_constructors ();
+void init_fontconfig ();
 std::vector<std::string> get_inclusion_names ();
 void set_inclusion_names (std::vector<std::string>);
 
@@ -34,7 +34,7 @@ public:
 
   int delta_ticks_;
   Midi_item *midi_;
-  std::string to_string () const;
+  void append_to (std::string *out) const;
 };
 
 /**
@@ -44,8 +44,9 @@ class Midi_chunk
 {
 public:
   void set (const std::string &header_string, const std::string &data_string, const std::string &footer_string);
-  virtual std::string to_string () const;
-  virtual std::string data_string () const;
+  // Append the chunk, with its length, to OUT.
+  void append_to (std::string *out) const;
+  virtual void append_data (std::string *out) const;
   VIRTUAL_CLASS_NAME (Midi_chunk);
   virtual ~Midi_chunk ();
 private:
@@ -75,7 +76,7 @@ public:
   ~Midi_track ();
 
   void add (int, Midi_item *midi);
-  std::string data_string () const override;
+  void append_data (std::string *out) const override;
   void push_back (int, Midi_item *midi);
 };
 
@@ -23,7 +23,8 @@
 #include "audio-item.hh"
 #include "std-vector.hh"
 
-std::string int2midi_varint_string (int i);
+// Append I to OUT as a MIDI variable length quantity.
+void append_midi_varint (std::string *out, int i);
 
 /**
    Any piece of midi information.
@@ -40,16 +41,17 @@ public:
 
   static Midi_item *get_midi (Audio_item *a);
 
-  virtual std::string to_string () const = 0;
+  // Append the MIDI bytes of this item to OUT.
+  virtual void append_to (std::string *out) const = 0;
 };
 
 class Midi_end_of_track : public Midi_item
 {
 public:
-  std::string to_string () const override
+  void append_to (std::string *out) const override
   {
     // the literal std::string's terminating null is part of the MIDI command
-    return std::string ("\xff\x2f", 3);
+    out->append ("\xff\x2f", 3);
   }
 };
 
@@ -67,7 +69,7 @@ class Midi_duration : public Midi_item
 public:
   Midi_duration (Real seconds_f);
 
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
   Real seconds_;
 };
 
@@ -80,7 +82,7 @@ public:
   OVERRIDE_CLASS_NAME (Midi_control_change);
   Midi_control_change (Audio_control_change *ai);
   virtual ~Midi_control_change ();
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
 
   Audio_control_change *audio_;
 };
@@ -94,7 +96,7 @@ public:
   Midi_instrument (Audio_instrument *);
 
   OVERRIDE_CLASS_NAME (Midi_instrument);
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
 
   Audio_instrument *audio_;
 };
@@ -105,7 +107,7 @@ public:
   Midi_key (Audio_key *);
   OVERRIDE_CLASS_NAME (Midi_key);
 
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
 
   Audio_key *audio_;
 };
@@ -116,7 +118,7 @@ public:
   Midi_time_signature (Audio_time_signature *);
   OVERRIDE_CLASS_NAME (Midi_time_signature);
 
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
 
   Audio_time_signature *audio_;
   int clocks_per_1_;
@@ -130,7 +132,7 @@ public:
 
   int get_semitone_pitch () const;
   int get_fine_tuning () const;
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
 
   Audio_note *audio_;
 
@@ -144,7 +146,7 @@ public:
   Midi_note_off (Midi_note *);
   OVERRIDE_CLASS_NAME (Midi_note_off);
 
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
 
   Midi_note *on_;
   Byte aftertouch_byte_;
@@ -162,7 +164,7 @@ public:
 
   Midi_text (Audio_text *);
 
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
 
   Audio_text *audio_;
 };
@@ -173,7 +175,7 @@ public:
   Midi_piano_pedal (Audio_piano_pedal *);
   OVERRIDE_CLASS_NAME (Midi_piano_pedal);
 
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
 
   Audio_piano_pedal *audio_;
 };
@@ -184,7 +186,7 @@ public:
   Midi_tempo (Audio_tempo *);
   OVERRIDE_CLASS_NAME (Midi_tempo);
 
-  std::string to_string () const override;
+  void append_to (std::string *) const override;
 
   Audio_tempo *audio_;
 };
@@ -26,6 +26,10 @@
 #include "std-string.hh"
 #include "lily-proto.hh"
 
+/*
+  The whole file is collected in memory and written when the stream
+  is destroyed.
+*/
 class Midi_stream
 {
 public:
@@ -36,6 +40,9 @@ public:
   void write (Midi_chunk const &);
 
 private:
+  void flush ();
+
+  std::string buffer_;
   int out_file_;
   std::string tmp_file_name_;
   std::string dest_file_name_;
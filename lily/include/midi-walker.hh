@@ -25,10 +25,12 @@
 #include "lily-proto.hh"
 #include "moment.hh"
 
+#include <map>
+
 class Midi_note_event : public PQueue_ent<int, Midi_note *>
 {
 public:
-  bool ignore_;
+  int pitch_;
   Midi_note_event ();
 };
 
@@ -59,6 +61,12 @@ private:
   vsize index_;
   std::vector<Audio_item *> items_;
   PQueue<Midi_note_event> stop_note_queue;
+
+  /*
+    The pending stop of each sounding pitch.  Entries of
+    stop_note_queue that do not match are stale and skipped.
+  */
+  std::map<int, Midi_note_event> playing_notes_;
   int last_tick_;
 
   std::vector<Midi_item *> midi_events_;
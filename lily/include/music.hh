@@ -40,6 +40,7 @@ class Music : Preinit_Music, public Prob, public Diagnostics
 public:
   Music (SCM init);
   Music (Music const &m);
+  ~Music ();
   OVERRIDE_CLASS_NAME (Music);
   virtual Music *clone () const { return new Music (*this); }
 
@@ -21,6 +21,7 @@
 #define OPEN_TYPE_FONT_HH
 
 #include "font-metric.hh"
+#include "font-metric-cache.hh"
 
 #include <unordered_map>
 
@@ -45,7 +46,8 @@ class Open_type_font : Preinit_Open_type_font, public Font_metric
   mutable std::unordered_map<std::string, size_t> name_to_index_map_;
 
   Index_to_charcode_map index_to_charcode_map_;
-  Open_type_font (FT_Face);
+  Font_metric_cache metric_cache_;
+  Open_type_font (FT_Face, const std::string &file_name);
 
   OVERRIDE_CLASS_NAME (Open_type_font);
 public:
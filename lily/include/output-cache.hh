@@ -0,0 +1,83 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OUTPUT_CACHE_HH
+#define OUTPUT_CACHE_HH
+
+#include "lily-proto.hh"
+#include "std-string.hh"
+#include "std-vector.hh"
+
+/*
+  With -doutput-cache=DIR, the output files of a run on an input file
+  are kept in DIR, and reused when the same file is processed again
+  with the same options and LilyPond version, and none of the files it
+  read through Sources (the input, its includes and the init files)
+  have changed.
+
+  The cache is keyed by the input and output file names, the options
+  and the version.  Each key has a manifest listing the fingerprints
+  of the files read and of the outputs written; the outputs are stored
+  under their fingerprint.  Files read in other ways, such as system
+  fonts or files loaded from Scheme, are not tracked.
+
+  The outputs are the files that LilyPond itself reports as written
+  with note_output (): the ports of paper outputters, MIDI files, and
+  files noted from Scheme with ly:note-output-file.  Renaming a file
+  does not note it, since caches such as the font embedding cache are
+  put in place the same way.
+*/
+class Output_cache
+{
+  std::string dir_;
+  std::string key_;
+
+  static bool recording_;
+  static std::vector<std::string> outputs_;
+
+  std::string manifest_name () const;
+  std::string blob_name (std::string const &fingerprint) const;
+
+public:
+  // The cache directory, made absolute, or "" if the cache is off.
+  // Call this before changing to the output directory.
+  static std::string directory ();
+
+  Output_cache (std::string const &dir, std::string const &input_file,
+                std::string const &out_file);
+  bool is_enabled () const { return !dir_.empty (); }
+
+  // Copy the cached outputs into place.  Return false on a miss.
+  bool restore () const;
+
+  // Store the outputs noted since the cache was created, and the
+  // fingerprints of the files read through SOURCES.
+  void store (Sources const &sources) const;
+
+  // Record that FILE_NAME was written, if a cache is collecting
+  // outputs.  Files that are gone by the time of store () (temporary
+  // files renamed later) are skipped.
+  static void note_output (std::string const &file_name);
+
+  static std::string fingerprint (std::string const &data);
+  // Return "" if FILE_NAME cannot be read.
+  static std::string file_fingerprint (std::string const &file_name);
+};
+
+#endif /* OUTPUT_CACHE_HH */
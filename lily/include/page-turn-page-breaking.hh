@@ -59,7 +59,19 @@ protected:
     }
   };
 
+  /* Counters describing how much of the search space was visited. */
+  struct Search_stats
+  {
+    vsize starts_explored_ = 0;
+    vsize starts_pruned_ = 0;
+    vsize system_counts_explored_ = 0;
+    vsize configurations_explored_ = 0;
+  };
+
   std::vector<Break_node> state_;
+  Search_stats stats_;
+
+  Real demerits_lower_bound (vsize start) const;
 
   vsize total_page_count (Break_node const &b);
   Break_node put_systems_on_pages (vsize start,
@@ -26,6 +26,10 @@
 #include <pango/pangoft2.h>
 
 #include "font-metric.hh"
+#include "stencil.hh"
+
+#include <list>
+#include <unordered_map>
 
 struct Preinit_Pango_font
 {
@@ -42,7 +46,29 @@ class Pango_font : Preinit_Pango_font, public Font_metric
   Real output_scale_;
   Direction text_direction_;
 
+  /*
+    Laid out strings, most recently used first.  Keyed on the features
+    and the text; the font description and scaling are those of this
+    font.
+  */
+  struct Text_cache_entry
+  {
+    std::string key_;
+    Stencil stencil_;
+  };
+  mutable std::list<Text_cache_entry> text_cache_;
+  mutable std::unordered_map<std::string,
+      std::list<Text_cache_entry>::iterator> text_cache_index_;
+  static const size_t text_cache_size_ = 1024;
+  static size_t text_cache_hits_;
+  static size_t text_cache_misses_;
+
+  Stencil layout_text (const std::string &text,
+                       const std::string &features_str) const;
+
 public:
+  static void report_text_cache_statistics ();
+
   SCM physical_font_tab () const;
   Pango_font (PangoFT2FontMap *,
               PangoFontDescription const *,
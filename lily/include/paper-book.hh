@@ -67,6 +67,7 @@ public:
 
   void classic_output (SCM output_channel);
   void output (SCM output_channel);
+  void release_layout ();
 
 protected:
   void classic_output_aux (SCM output,
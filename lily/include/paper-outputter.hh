@@ -22,11 +22,14 @@
 
 #include "cpu-timer.hh"
 #include "lily-proto.hh"
+#include "ps-emitter.hh"
 #include "std-vector.hh"
 #include "std-string.hh"
 #include "protected-scm.hh"
 #include "smobs.hh"
 
+#include <memory>
+
 /*
   Glue between the backend (grobs, systems, pages) and the output file.
   proxy for Scheme backends.
@@ -42,14 +45,28 @@ private:
   SCM file_;
   SCM callback_tab_;
   SCM default_callback_;
+  std::unique_ptr<Ps_emitter> ps_emitter_;
+  std::string native_buffer_;
+
+  /* Strings not yet written to file_, see dump_string (). */
+  std::vector<SCM> pending_;
+  size_t pending_length_;
+  size_t bytes_written_;
+  Real write_time_;
+
+  bool output_native (SCM head, vsize argc, SCM const *argv);
 
 public:
   Paper_outputter (SCM port, SCM alist, SCM default_callback);
 
   void close ();
+  void flush ();
+  void use_native_ps (SCM font_command_proc);
   SCM dump_string (SCM);
-  SCM file () const;
+  SCM file ();
   SCM output_scheme (SCM scm);
+  SCM output_command (SCM head, vsize argc, SCM const *argv);
+  void output_display_list (Display_list const &);
   void output_stencil (Stencil);
   SCM scheme_to_string (SCM);
 };
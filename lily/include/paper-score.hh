@@ -52,6 +52,7 @@ public:
   std::vector<vsize> const &get_break_ranks () const;
   std::vector<Paper_column *> const &get_columns () const;
   SCM get_paper_systems ();
+  void release_layout ();
 protected:
   void find_break_indices () const;
   void process () override;
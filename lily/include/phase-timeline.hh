@@ -0,0 +1,104 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PHASE_TIMELINE_HH
+#define PHASE_TIMELINE_HH
+
+#include "cpu-timer.hh"
+#include "real.hh"
+#include "std-string.hh"
+#include "std-vector.hh"
+
+#include <chrono>
+
+/*
+  Wall clock time, CPU time and memory use of the processing phases
+  (parsing, translation, line breaking, ...) of a run.  Phases nest;
+  each record also notes how much of its time was spent outside its
+  sub-phases.  With -dphase-timeline=FILE, the timeline is written to
+  FILE in JSON format when LilyPond exits.
+
+  Every phase is also a named Cpu_timer scope, so its time shows up
+  in the timing totals next to the scopes timed elsewhere.
+*/
+class Phase_timeline
+{
+public:
+  struct Record
+  {
+    std::string name_;
+    std::string detail_;
+    int depth_;
+    Real start_;
+    Real wall_;
+    Real cpu_;
+    Real children_wall_;
+    Real gc_time_;
+    size_t gc_heap_;
+    vsize grobs_;
+    long peak_rss_;
+  };
+
+  // Open and close phases explicitly, for phases not bounded by a
+  // single C++ scope.  begin () returns the index of the new record.
+  static vsize begin (char const *name, std::string const &detail = "");
+  static void end ();
+
+  // Close the phase INDEX and any phases still open inside it, which
+  // a Scheme error may have skipped.
+  static void end (vsize index);
+
+  static void write_json (std::string const &file_name);
+
+  /* Time a phase for the lifetime of the object. */
+  class Scope
+  {
+  public:
+    Scope (char const *name, std::string const &detail = "")
+      : index_ (begin (name, detail))
+    {
+    }
+    ~Scope () { end (index_); }
+    Scope (Scope const &) = delete;
+    Scope &operator = (Scope const &) = delete;
+
+  private:
+    vsize index_;
+  };
+
+private:
+  typedef Cpu_timer::Clock Clock;
+
+  struct Open_phase
+  {
+    char const *name_;
+    vsize index_;
+    vsize timer_depth_;
+    Clock::time_point start_;
+    Real start_cpu_;
+    Real start_gc_time_;
+  };
+
+  static Clock::time_point origin ();
+  static void close_innermost ();
+  static std::vector<Record> records_;
+  static std::vector<Open_phase> open_;
+};
+
+#endif /* PHASE_TIMELINE_HH */
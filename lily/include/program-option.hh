@@ -25,6 +25,7 @@
 
 SCM ly_get_option (SCM);
 SCM ly_set_option (SCM, SCM);
+SCM ly_all_options ();
 
 bool get_program_option (const char *);
 std::string get_output_backend_name ();
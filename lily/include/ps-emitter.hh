@@ -0,0 +1,50 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PS_EMITTER_HH
+#define PS_EMITTER_HH
+
+#include "lily-guile.hh"
+#include "std-string.hh"
+
+/*
+  Native versions of the most frequent stencil commands of the
+  PostScript backend.  The output must be byte for byte the same as
+  that of the callbacks in scm/output-ps.scm; commands (or arguments)
+  that are not handled here go through the Scheme backend.
+*/
+class Ps_emitter
+{
+  SCM font_command_proc_;
+  SCM font_commands_;
+  bool music_font_encodings_;
+
+public:
+  Ps_emitter (SCM font_command_proc);
+  void mark () const;
+
+  // Append the output for (HEAD ARGV...) to OUT and return true, or
+  // return false if the command must be handled by the backend.
+  bool emit (SCM head, vsize argc, SCM const *argv, std::string *out);
+
+private:
+  std::string font_command (SCM font);
+};
+
+#endif /* PS_EMITTER_HH */
@@ -20,8 +20,7 @@
 #ifndef SLUR_CONFIGURATION_HH
 #define SLUR_CONFIGURATION_HH
 
-#include <memory>
-
+#include "arena.hh"
 #include "bezier.hh"
 #include "lily-proto.hh"
 #include "std-vector.hh"
@@ -62,7 +61,9 @@ public:
                        std::vector<Offset> const &);
   void run_next_scorer (Slur_score_state const &);
   bool done () const;
-  static std::unique_ptr<Slur_configuration> new_config (Drul_array<Offset> const &offs, size_t idx);
+  static Slur_configuration *new_config (Arena<Slur_configuration> *arena,
+                                         Drul_array<Offset> const &offs,
+                                         size_t idx);
 
 protected:
   void score_extra_encompass (Slur_score_state const &);
@@ -0,0 +1,83 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef SMOB_CENSUS_HH
+#define SMOB_CENSUS_HH
+
+#include "lily-guile.hh"
+#include "lily-proto.hh"
+#include "std-string.hh"
+#include "std-vector.hh"
+
+#include <map>
+
+extern bool smob_census;
+
+/*
+  How many smobs of each type are alive, and how many grobs of each
+  type (by grob name) the Systems in memory hold.  Byte counts are
+  approximate: they cover the C++ object and, for grobs, the cells of
+  the mutable property and object alists, but not memory owned
+  otherwise, like the buildings of a Skyline.
+
+  With -dsmob-census, a census is printed at the end of every
+  processing phase.
+*/
+class Smob_census
+{
+public:
+  enum Kind
+  {
+    SMOB,
+    SUBCLASS,                   // also counted in its parent smob type
+    GROB,                       // also counted as a Grob smob
+  };
+
+  struct Entry
+  {
+    std::string name_;
+    Kind kind_;
+    vsize count_;
+    size_t bytes_;
+    vsize alist_entries_;
+  };
+
+  // Collect garbage, then count what is left.
+  Smob_census ();
+
+  void add_grob (std::string const &name, size_t bytes, vsize alist_entries);
+
+  // All entries, largest first.
+  std::vector<Entry> entries () const;
+  std::string table (std::string const &title) const;
+
+  static void take (char const *phase);
+
+  // Root systems register themselves, so their grobs can be found.
+  // The registry is weak: a system that is no longer reachable drops
+  // out of it before it is finalized.
+  static void add_system (System *);
+
+private:
+  std::vector<Entry> smobs_;
+  std::map<std::string, Entry> grobs_;
+};
+
+#endif /* SMOB_CENSUS_HH */
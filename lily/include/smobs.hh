@@ -168,11 +168,36 @@ public:
   static void init ();
 };
 
+// The number and size of the live objects of one type, for
+// -dsmob-census.  All counters are chained into one list, like the
+// Scm_init functions.  A counter with a parent counts a subclass
+// whose objects its parent's counter also includes.
+
+class Smob_counter
+{
+  static Smob_counter *list_;
+  Smob_counter *const next_;
+  Smob_counter (const Smob_counter &);  // don't define copy constructor
+public:
+  char const *name_;
+  char const *parent_;
+  size_t live_;
+  size_t bytes_;
+  Smob_counter (char const *name = 0, char const *parent = 0)
+    : next_ (list_), name_ (name), parent_ (parent), live_ (0), bytes_ (0)
+  { list_ = this; }
+  void add (size_t bytes) { live_++; bytes_ += bytes; }
+  void remove (size_t bytes) { live_--; bytes_ -= bytes; }
+  Smob_counter const *next () const { return next_; }
+  static Smob_counter const *list () { return list_; }
+};
+
 template <class Super>
 class Smob_base
 {
   static scm_t_bits smob_tag_;
   static Scm_init scm_init_;
+  static Smob_counter counter_;
   static void init (void);
   static std::string smob_name_;
 protected:
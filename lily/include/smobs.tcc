@@ -57,6 +57,7 @@ Smob_base<Super>::register_ptr (Super *p)
   SCM s = SCM_UNDEFINED;
   SCM_NEWSMOB (s, smob_tag (), p);
   scm_gc_register_collectable_memory (p, sizeof (*p), smob_name_.c_str ());
+  counter_.add (sizeof (*p));
   return s;
 }
 
@@ -100,6 +101,7 @@ Smob_base<Super>::unregister_ptr (SCM obj)
 {
   Super *p = Super::unchecked_unsmob (obj);
   scm_gc_unregister_collectable_memory (p, sizeof (*p), smob_name_.c_str ());
+  counter_.remove (sizeof (*p));
   SCM_SET_SMOB_DATA (obj, static_cast<Super *> (0));
   return p;
 }
@@ -110,6 +112,9 @@ scm_t_bits Smob_base<Super>::smob_tag_ = 0;
 template <class Super>
 Scm_init Smob_base<Super>::scm_init_ (init);
 
+template <class Super>
+Smob_counter Smob_base<Super>::counter_;
+
 template <class Super>
 std::string Smob_base<Super>::smob_name_;
 
@@ -125,6 +130,7 @@ void Smob_base<Super>::init ()
   // unsuitable for Texinfo documentation.  If that proves to be an
   // issue, we need some smarter strategy.
   smob_name_ = smob_name_.substr (smob_name_.find_first_not_of ("0123456789"));
+  counter_.name_ = smob_name_.c_str ();
   assert (!smob_tag_);
   smob_tag_ = scm_make_smob_type (smob_name_.c_str (), 0);
   // The following have trivial private default definitions not
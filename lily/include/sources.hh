@@ -41,6 +41,7 @@ public:
 
   Source_file *get_file (std::string file_name, std::string const &currentpath);
   void add (Source_file *sourcefile);
+  std::vector<Source_file *> const &files () const { return sourcefiles_; }
   std::string search_path () const;
   void set_path (File_path *);
 };
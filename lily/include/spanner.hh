@@ -43,7 +43,6 @@
 struct Preinit_Spanner
 {
   Drul_array<Item *> spanned_drul_;
-  SCM pure_property_cache_;
   Preinit_Spanner ();
 };
 
@@ -93,9 +92,6 @@ public:
   void derived_mark () const override;
   System *get_system () const override;
 
-  SCM get_cached_pure_property (SCM sym, vsize start, vsize end);
-  void cache_pure_property (SCM sym, vsize start, vsize end, SCM value);
-
 protected:
   void set_my_columns ();
   Spanner *clone () const override { return new Spanner (*this); }
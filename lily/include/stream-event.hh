@@ -29,6 +29,8 @@ class Stream_event : public Prob, public Diagnostics
 {
 public:
   Stream_event ();
+  Stream_event (Stream_event const &);
+  ~Stream_event ();
   OVERRIDE_CLASS_NAME (Stream_event);
   virtual Stream_event *clone () const { return new Stream_event (*this); }
 
@@ -93,8 +93,11 @@ public:
 
   vsize element_count () const;
   vsize spanner_count () const;
+  void add_to_census (Smob_census *) const;
 
   void break_into_pieces (std::vector<Column_x_positions> const &);
+  void release_layout ();
+  void clear_pure_caches ();
 
   std::vector<Item *> broken_col_range (Item const *, Item const *) const;
   std::vector<Paper_column *> used_columns_in_range (vsize start, vsize end) const;
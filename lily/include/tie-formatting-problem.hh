@@ -20,6 +20,7 @@
 #ifndef TIE_FORMATTING_PROBLEM_HH
 #define TIE_FORMATTING_PROBLEM_HH
 
+#include "arena.hh"
 #include "drul-array.hh"
 #include "skyline.hh"
 #include "tie-configuration.hh"
@@ -57,6 +58,8 @@ class Tie_formatting_problem
   std::vector<Tie_specification> specifications_;
   bool use_horizontal_spacing_;
 
+  // Owns the configurations in possibilities_.
+  mutable Arena<Tie_configuration> configuration_arena_;
   Tie_configuration_map possibilities_;
 
   Grob *x_refpoint_;
@@ -91,7 +94,6 @@ public:
 
 public:
   Tie_formatting_problem ();
-  ~Tie_formatting_problem ();
 
   Tie_specification get_tie_specification (int) const;
   Ties_configuration generate_optimal_configuration ();
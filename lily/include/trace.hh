@@ -0,0 +1,133 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TRACE_HH
+#define TRACE_HH
+
+#include "lily-guile.hh"
+#include "lily-proto.hh"
+#include "std-vector.hh"
+
+#include <chrono>
+#include <cstdint>
+
+extern bool trace_events;
+
+/*
+  Opt-in tracing of time steps, translator calls, grob callbacks and
+  processing phases, for finding out which engraver or callback makes
+  a score slow.
+
+  With -dtrace-events=FILE, events are collected into a ring buffer
+  holding the last -dtrace-event-limit of them, and written to FILE in
+  the Chrome trace event format on exit.  Such files can be viewed
+  with Perfetto or chrome://tracing.
+
+  When tracing is off, a Scope costs one test of trace_events.  Names
+  are only looked up when an event is recorded.
+*/
+class Trace
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  enum Category
+  {
+    PHASE,
+    TRANSLATION,
+    CALLBACK,
+  };
+
+  /* The name of an event, resolved only when tracing. */
+  struct Label
+  {
+    char const *str_;
+    SCM sym_;
+    Grob const *grob_;
+    Translator const *translator_;
+
+    Label () : str_ (0), sym_ (SCM_BOOL_F), grob_ (0), translator_ (0) {}
+    Label (char const *s) : Label () { str_ = s; }
+    Label (SCM sym) : Label () { sym_ = sym; }
+    Label (Grob const *g) : Label () { grob_ = g; }
+    Label (Translator const *t) : Label () { translator_ = t; }
+  };
+
+  class Scope
+  {
+  public:
+    Scope (Category category, Label name, Label detail = Label ())
+      : active_ (trace_events), category_ (category),
+        name_ (name), detail_ (detail), has_value_ (false), value_ (0.0)
+    {
+      if (active_)
+        start_ = Clock::now ();
+    }
+    Scope (Category category, Label name, Real value)
+      : Scope (category, name)
+    {
+      has_value_ = true;
+      value_ = value;
+    }
+    ~Scope ()
+    {
+      if (active_)
+        record (category_, name_, detail_, start_, Clock::now (),
+                has_value_, value_);
+    }
+    Scope (Scope const &) = delete;
+    Scope &operator = (Scope const &) = delete;
+
+  private:
+    bool active_;
+    Category category_;
+    Label name_;
+    Label detail_;
+    bool has_value_;
+    Real value_;
+    Clock::time_point start_;
+  };
+
+  static void record (Category category, Label const &name,
+                      Label const &detail, Clock::time_point start,
+                      Clock::time_point end, bool has_value = false,
+                      Real value = 0.0);
+  static void write_json (std::string const &file_name);
+
+private:
+  struct Event
+  {
+    uint32_t name_;
+    uint32_t detail_;
+    Category category_;
+    bool has_value_;
+    Real value_;
+    Clock::time_point start_;
+    Clock::duration duration_;
+  };
+
+  static uint32_t intern (Label const &);
+
+  static std::vector<Event> events_;
+  static vsize limit_;
+  static vsize next_;
+  static vsize dropped_;
+};
+
+#endif /* TRACE_HH */
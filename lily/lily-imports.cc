@@ -84,6 +84,9 @@ Variable make_music ("make-music");
 Variable make_safe_lilypond_module ("make-safe-lilypond-module");
 Variable make_span_event ("make-span-event");
 Variable markup_p ("markup?");
+Variable markup_cache_key ("markup-cache-key");
+Variable markup_cache_ref ("markup-cache-ref");
+Variable markup_cache_set_x ("markup-cache-set!");
 Variable markup_command_signature ("markup-command-signature");
 Variable markup_function_p ("markup-function?");
 Variable markup_list_function_p ("markup-list-function?");
@@ -25,6 +25,8 @@
 #include "international.hh"
 #include "lily-lexer.hh"
 #include "main.hh"
+#include "output-cache.hh"
+#include "phase-timeline.hh"
 #include "program-option.hh"
 #include "sources.hh"
 #include "warn.hh"
@@ -45,6 +47,11 @@ LY_DEFINE (ly_parse_file, "ly:parse-file",
 
   string file_name = global_path.find (file, extensions);
 
+  Phase_timeline::Scope phase ("parsing", file_name);
+
+  // Resolve the cache directory before changing to the output directory.
+  string cache_dir = Output_cache::directory ();
+
   /* By default, use base name of input file for output file name,
      write output to cwd; do not use root and directory parts of input
      file name.  */
@@ -119,14 +126,23 @@ LY_DEFINE (ly_parse_file, "ly:parse-file",
       string mapped_fn = map_file_name (file_name);
       basic_progress (_f ("Processing `%s'", mapped_fn.c_str ()));
 
-      Lily_parser *parser = new Lily_parser (&sources);
+      Output_cache cache (cache_dir, file_name, out_file);
+      if (cache.restore ())
+        basic_progress (_f ("Reusing cached output for `%s'",
+                            mapped_fn.c_str ()));
+      else
+        {
+          Lily_parser *parser = new Lily_parser (&sources);
 
-      parser->parse_file (init, file_name, out_file);
+          parser->parse_file (init, file_name, out_file);
 
-      error = parser->error_level_;
+          error = parser->error_level_;
+          if (!error)
+            cache.store (sources);
 
-      parser->clear ();
-      parser->unprotect ();
+          parser->clear ();
+          parser->unprotect ();
+        }
     }
 
   /*
@@ -45,6 +45,7 @@
 #include "international.hh"
 #include "lily-version.hh"
 #include "misc.hh"
+#include "phase-timeline.hh"
 #include "output-def.hh"
 #include "program-option.hh"
 #include "relocate.hh"
@@ -383,7 +384,6 @@ prepend_scheme_list (const string &dir, const string &scmlist)
 }
 
 void init_global_tweak_registry ();
-void init_fontconfig ();
 
 #if HAVE_CHROOT
 static void
@@ -520,16 +520,20 @@ main_with_guile (void *, int, char **)
   if (is_loglevel (LOG_DEBUG))
     dir_info (stderr);
 
+  Phase_timeline::end ();
+  Phase_timeline::begin ("guile-init");
+
   init_scheme_variables_global = "(" + init_scheme_variables_global + ")";
   init_scheme_code_global = "(begin " + init_scheme_code_global + ")";
 
   ly_c_init_guile ();
   call_constructors ();
-  init_fontconfig ();
 
   init_freetype ();
   ly_reset_all_fonts ();
 
+  Phase_timeline::end ();
+
   /*
      We accept multiple independent music files on the command line to
      reduce compile time when processing lots of small files.
@@ -893,6 +897,8 @@ main (int argc, char **argv, char **envp)
  * envp:   Point to vector of OS environment variables
  */
 {
+  Phase_timeline::begin ("startup");
+
   /*
     Process environment variables
   */
@@ -126,17 +126,16 @@ Midi_track::add (int delta_ticks, Midi_item *midi)
   events_.insert (position, e);
 }
 
-string
-Midi_track::data_string () const
+void
+Midi_track::append_data (string *out) const
 {
-  string str = Midi_chunk::data_string ();
+  Midi_chunk::append_data (out);
 
   for (vector<Midi_event *>::const_iterator i (events_.begin ());
        i != events_.end (); i++)
     {
-      str += (*i)->to_string ();
+      (*i)->append_to (out);
     }
-  return str;
 }
 
 Midi_track::~Midi_track ()
@@ -153,12 +152,11 @@ Midi_event::Midi_event (int delta_ticks, Midi_item *midi)
   midi_ = midi;
 }
 
-string
-Midi_event::to_string () const
+void
+Midi_event::append_to (string *out) const
 {
-  string delta_string = int2midi_varint_string (delta_ticks_);
-  string midi_string = midi_->to_string ();
-  return delta_string + midi_string;
+  append_midi_varint (out, delta_ticks_);
+  midi_->append_to (out);
 }
 /****************************************************************
  header
@@ -188,21 +186,24 @@ Midi_chunk::set (const string &header_string, const string &data_string, const s
   header_string_ = header_string;
 }
 
-string
-Midi_chunk::data_string () const
+void
+Midi_chunk::append_data (string *out) const
 {
-  return data_string_;
+  *out += data_string_;
 }
 
-string
-Midi_chunk::to_string () const
+void
+Midi_chunk::append_to (string *out) const
 {
-  string str = header_string_;
-  string dat = data_string ();
-  uint32_t total = uint32_t (dat.length () + footer_string_.length ());
-  str += String_convert::be_u32 (total);
-  str += dat;
-  str += footer_string_;
-
-  return str;
+  *out += header_string_;
+
+  // The length is only known after the data is written; patch it in
+  // afterwards.
+  size_t length_pos = out->length ();
+  *out += String_convert::be_u32 (0);
+  append_data (out);
+  *out += footer_string_;
+
+  uint32_t total = uint32_t (out->length () - length_pos - 4);
+  out->replace (length_pos, 4, String_convert::be_u32 (total));
 }
@@ -65,10 +65,10 @@ Midi_duration::Midi_duration (Real seconds_f)
   seconds_ = seconds_f;
 }
 
-string
-Midi_duration::to_string () const
+void
+Midi_duration::append_to (string *out) const
 {
-  return string ("<duration: ") + std::to_string (seconds_) + ">";
+  *out += string ("<duration: ") + std::to_string (seconds_) + ">";
 }
 
 Midi_instrument::Midi_instrument (Audio_instrument *a)
@@ -78,8 +78,8 @@ Midi_instrument::Midi_instrument (Audio_instrument *a)
   audio_->str_ = String_convert::to_lower (audio_->str_);
 }
 
-string
-Midi_instrument::to_string () const
+void
+Midi_instrument::append_to (string *out) const
 {
   Byte program_byte = 0;
   bool found = false;
@@ -91,9 +91,8 @@ Midi_instrument::to_string () const
   else
     warning (_f ("no such MIDI instrument: `%s'", audio_->str_.c_str ()));
 
-  string str (1, static_cast<char> (0xc0 + channel_)); //YIKES! FIXME : Should be track. -rz
-  str += program_byte;
-  return str;
+  *out += static_cast<char> (0xc0 + channel_); //YIKES! FIXME : Should be track. -rz
+  *out += program_byte;
 }
 
 Midi_item::Midi_item ()
@@ -123,8 +122,8 @@ Midi_control_change::~Midi_control_change ()
 {
 }
 
-string
-int2midi_varint_string (int i)
+void
+append_midi_varint (string *out, int i)
 {
   int buffer = i & 0x7f;
   while ((i >>= 7) > 0)
@@ -134,16 +133,14 @@ int2midi_varint_string (int i)
       buffer += (i & 0x7f);
     }
 
-  string str;
   while (1)
     {
-      str += static_cast<char> (buffer);
+      *out += static_cast<char> (buffer);
       if (buffer & 0x80)
         buffer >>= 8;
       else
         break;
     }
-  return str;
 }
 
 Midi_key::Midi_key (Audio_key *a)
@@ -151,13 +148,13 @@ Midi_key::Midi_key (Audio_key *a)
 {
 }
 
-string
-Midi_key::to_string () const
+void
+Midi_key::append_to (string *out) const
 {
   uint8_t str[] = {0xff, 0x59, 0x02, uint8_t (audio_->accidentals_),
                    uint8_t (audio_->major_ ? 0 : 1)};
 
-  return string ((char *) str, sizeof (str));
+  out->append ((char *) str, sizeof (str));
 }
 
 Midi_time_signature::Midi_time_signature (Audio_time_signature *a)
@@ -166,8 +163,8 @@ Midi_time_signature::Midi_time_signature (Audio_time_signature *a)
 {
 }
 
-string
-Midi_time_signature::to_string () const
+void
+Midi_time_signature::append_to (string *out) const
 {
   int num = abs (audio_->beats_);
   if (num > 255)
@@ -178,14 +175,14 @@ Midi_time_signature::to_string () const
 
   int den = audio_->one_beat_;
 
-  uint8_t out[] = {0xff,
-                   0x58,
-                   0x04,
-                   uint8_t (num),
-                   uint8_t (intlog2 (den)),
-                   uint8_t (clocks_per_1_),
-                   8};
-  return string ((char *) out, sizeof (out));
+  uint8_t bytes[] = {0xff,
+                     0x58,
+                     0x04,
+                     uint8_t (num),
+                     uint8_t (intlog2 (den)),
+                     uint8_t (clocks_per_1_),
+                     8};
+  out->append ((char *) bytes, sizeof (bytes));
 }
 
 Midi_note::Midi_note (Audio_note *a)
@@ -217,11 +214,10 @@ Midi_note::get_semitone_pitch () const
   return int (rint (tune));
 }
 
-string
-Midi_note::to_string () const
+void
+Midi_note::append_to (string *out) const
 {
   Byte status_byte = (char) (0x90 + channel_);
-  string str = "";
   int finetune;
 
   // print warning if fine tuning was needed, HJJ
@@ -229,17 +225,15 @@ Midi_note::to_string () const
     {
       finetune = PITCH_WHEEL_CENTER + get_fine_tuning ();
 
-      str += static_cast<char> (0xE0 + channel_);
-      str += static_cast<char> (finetune & 0x7F);
-      str += static_cast<char> (finetune >> 7);
-      str += static_cast<char> (0x00);
+      *out += static_cast<char> (0xE0 + channel_);
+      *out += static_cast<char> (finetune & 0x7F);
+      *out += static_cast<char> (finetune >> 7);
+      *out += static_cast<char> (0x00);
     }
 
-  str += status_byte;
-  str += static_cast<char> (get_semitone_pitch () + c0_pitch_);
-  str += dynamic_byte_;
-
-  return str;
+  *out += status_byte;
+  *out += static_cast<char> (get_semitone_pitch () + c0_pitch_);
+  *out += dynamic_byte_;
 }
 
 Midi_note_off::Midi_note_off (Midi_note *n)
@@ -252,25 +246,23 @@ Midi_note_off::Midi_note_off (Midi_note *n)
   aftertouch_byte_ = 0;
 }
 
-string
-Midi_note_off::to_string () const
+void
+Midi_note_off::append_to (string *out) const
 {
   Byte status_byte = (char) (0x90 + channel_);
 
-  string str (1, status_byte);
-  str += static_cast<char> (get_semitone_pitch () + Midi_note::c0_pitch_);
-  str += aftertouch_byte_;
+  *out += status_byte;
+  *out += static_cast<char> (get_semitone_pitch () + Midi_note::c0_pitch_);
+  *out += aftertouch_byte_;
 
   if (get_fine_tuning () != 0)
     {
       // Move pitch wheel back to the central position.
-      str += static_cast<char> (0x00);
-      str += static_cast<char> (0xE0 + channel_);
-      str += static_cast<char> (PITCH_WHEEL_CENTER & 0x7F);
-      str += static_cast<char> (PITCH_WHEEL_CENTER >> 7);
+      *out += static_cast<char> (0x00);
+      *out += static_cast<char> (0xE0 + channel_);
+      *out += static_cast<char> (PITCH_WHEEL_CENTER & 0x7F);
+      *out += static_cast<char> (PITCH_WHEEL_CENTER >> 7);
     }
-
-  return str;
 }
 
 Midi_piano_pedal::Midi_piano_pedal (Audio_piano_pedal *a)
@@ -279,22 +271,21 @@ Midi_piano_pedal::Midi_piano_pedal (Audio_piano_pedal *a)
 {
 }
 
-string
-Midi_piano_pedal::to_string () const
+void
+Midi_piano_pedal::append_to (string *out) const
 {
   Byte status_byte = (char) (0xB0 + channel_);
-  string str (1, status_byte);
+  *out += status_byte;
 
   if (audio_->type_string_ == "Sostenuto")
-    str += static_cast<char> (0x42);
+    *out += static_cast<char> (0x42);
   else if (audio_->type_string_ == "Sustain")
-    str += static_cast<char> (0x40);
+    *out += static_cast<char> (0x40);
   else if (audio_->type_string_ == "UnaCorda")
-    str += static_cast<char> (0x43);
+    *out += static_cast<char> (0x43);
 
   int pedal = ((1 - audio_->dir_) / 2) * 0x7f;
-  str += static_cast<char> (pedal);
-  return str;
+  *out += static_cast<char> (pedal);
 }
 
 Midi_tempo::Midi_tempo (Audio_tempo *a)
@@ -302,13 +293,13 @@ Midi_tempo::Midi_tempo (Audio_tempo *a)
 {
 }
 
-string
-Midi_tempo::to_string () const
+void
+Midi_tempo::append_to (string *out) const
 {
   uint32_t useconds_per_4 = 60 * (int) 1e6 / audio_->per_minute_4_;
-  uint8_t out[] = {0xff, 0x51, 0x03};
-  return string ((char *) out, sizeof (out))
-         + String_convert::be_u24 (useconds_per_4);
+  uint8_t bytes[] = {0xff, 0x51, 0x03};
+  out->append ((char *) bytes, sizeof (bytes));
+  *out += String_convert::be_u24 (useconds_per_4);
 }
 
 Midi_text::Midi_text (Audio_text *a)
@@ -316,24 +307,22 @@ Midi_text::Midi_text (Audio_text *a)
 {
 }
 
-string
-Midi_text::to_string () const
+void
+Midi_text::append_to (string *out) const
 {
   uint8_t text_code[] = {0xff, audio_->type_};
-  string str ((char *) text_code, sizeof (text_code));
-  str += int2midi_varint_string (int (audio_->text_string_.length ()));
-  str += audio_->text_string_;
-  return str;
+  out->append ((char *) text_code, sizeof (text_code));
+  append_midi_varint (out, int (audio_->text_string_.length ()));
+  *out += audio_->text_string_;
 }
 
-string
-Midi_control_change::to_string () const
+void
+Midi_control_change::append_to (string *out) const
 {
   Byte status_byte = (char) (0xB0 + channel_);
-  string str (1, status_byte);
-  str += static_cast<char> (audio_->control_);
-  str += static_cast<char> (audio_->value_);
-  return str;
+  *out += status_byte;
+  *out += static_cast<char> (audio_->control_);
+  *out += static_cast<char> (audio_->value_);
 }
 
 char const *
@@ -24,6 +24,7 @@
 #include "main.hh"
 #include "midi-chunk.hh"
 #include "misc.hh"
+#include "output-cache.hh"
 #include "program-option.hh"
 #include "string-convert.hh"
 #include "warn.hh"
@@ -36,6 +37,7 @@ using std::string;
 Midi_stream::Midi_stream (const string &file_name)
 {
   dest_file_name_ = file_name;
+  buffer_.reserve (1 << 16);
   int tries = 10;
 
   int flags = O_WRONLY | O_CREAT | O_EXCL;
@@ -60,6 +62,7 @@ Midi_stream::Midi_stream (const string &file_name)
 
 Midi_stream::~Midi_stream ()
 {
+  flush ();
   close (out_file_);
 
   if (!rename_file (tmp_file_name_.c_str (), dest_file_name_.c_str ()))
@@ -67,23 +70,39 @@ Midi_stream::~Midi_stream ()
       error (_f ("cannot rename `%s' to `%s'", tmp_file_name_.c_str (),
                  dest_file_name_.c_str ()));
     }
+  Output_cache::note_output (dest_file_name_);
 }
 
 void
-Midi_stream::write (const string &str)
+Midi_stream::flush ()
 {
-  size_t count = str.length ();
-  size_t written = ::write (out_file_, str.data (), count);
+  char const *data = buffer_.data ();
+  size_t count = buffer_.length ();
+  while (count > 0)
+    {
+      ssize_t written = ::write (out_file_, data, count);
+      if (written < 0 && errno == EINTR)
+        continue;
+      if (written <= 0)
+        {
+          warning (_f ("cannot write to file: `%s': %s",
+                       tmp_file_name_.c_str (), strerror (errno)));
+          break;
+        }
+      data += written;
+      count -= written;
+    }
+  buffer_.clear ();
+}
 
-  if (written != count)
-    warning (_f ("cannot write to file: `%s': %s", tmp_file_name_.c_str ()),
-             strerror (errno));
+void
+Midi_stream::write (const string &str)
+{
+  buffer_ += str;
 }
 
 void
 Midi_stream::write (Midi_chunk const &midi)
 {
-  string str = midi.to_string ();
-
-  return write (str);
+  midi.append_to (&buffer_);
 }
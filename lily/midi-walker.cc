@@ -27,19 +27,19 @@
 #include "midi-stream.hh"
 #include "warn.hh"
 
+#include <algorithm>
+
 Midi_note_event::Midi_note_event ()
 {
-  ignore_ = false;
+  pitch_ = 0;
 }
 
 int
 compare (Midi_note_event const &left, Midi_note_event const &right)
 {
-  Moment m = (left.key - right.key);
-
-  if (m < 0)
+  if (left.key < right.key)
     return -1;
-  else if (m > 0)
+  else if (left.key > right.key)
     return 1;
   else
     return 0;
@@ -57,7 +57,9 @@ Midi_walker::Midi_walker (Audio_staff *audio_staff, Midi_track *track, int start
   track_ = track;
   index_ = 0;
   items_ = audio_staff->audio_items_;
-  vector_stable_sort (items_, audio_item_less);
+  // Performers mostly announce items in time order already.
+  if (!std::is_sorted (items_.begin (), items_.end (), audio_item_less))
+    vector_stable_sort (items_, audio_item_less);
   //Scores that begin with grace notes start at negative times. This
   //is OK - MIDI output doesn't use absolute ticks, only differences.
   last_tick_ = start_tick;
@@ -90,43 +92,36 @@ Midi_walker::do_start_note (Midi_note *note)
   int stop_ticks = int (moment_to_real (note->audio_->length_mom_)
                         * static_cast<Real> (384 * 4))
                    + now_ticks;
-  for (vsize i = 0; i < stop_note_queue.size (); i++)
+  int pitch = note->get_semitone_pitch ();
+
+  /* if this pitch is already sounding */
+  auto playing = playing_notes_.find (pitch);
+  if (playing != playing_notes_.end ())
     {
-      /* if this pitch already in queue, and is not already ignored */
-      if (!stop_note_queue[i].ignore_
-          && stop_note_queue[i].val->get_semitone_pitch ()
-          == note->get_semitone_pitch ())
+      Midi_note_event &queued = playing->second;
+      int queued_ticks = queued.val->audio_->audio_column_->ticks ();
+      // If the two notes started at the same time, or option is set,
+      if (now_ticks == queued_ticks || merge_unisons_)
         {
-          int queued_ticks
-            = stop_note_queue[i].val->audio_->audio_column_->ticks ();
-          // If the two notes started at the same time, or option is set,
-          if (now_ticks == queued_ticks || merge_unisons_)
+          // merge them.
+          if (queued.key < stop_ticks)
             {
-              // merge them.
-              if (stop_note_queue[i].key < stop_ticks)
-                {
-                  Midi_note_event e;
-                  e.val = stop_note_queue[i].val;
-                  e.key = stop_ticks;
-                  stop_note_queue[i].ignore_ = true;
-                  stop_note_queue.insert (e);
-                }
-              note = 0;
-              break;
+              queued.key = stop_ticks;
+              stop_note_queue.insert (queued);
             }
-          else
+          note = 0;
+        }
+      else
+        {
+          // A note was played that interruped a played note.
+          // Stop the old note, and continue to the greatest moment
+          // between the two.
+          if (queued.key > stop_ticks)
             {
-              // A note was played that interruped a played note.
-              // Stop the old note, and continue to the greatest moment
-              // between the two.
-              if (stop_note_queue[i].key > stop_ticks)
-                {
-                  stop_ticks = stop_note_queue[i].key;
-                }
-              output_event (now_ticks, stop_note_queue[i].val);
-              stop_note_queue[i].ignore_ = true;
-              break;
+              stop_ticks = queued.key;
             }
+          output_event (now_ticks, queued.val);
+          playing_notes_.erase (playing);
         }
     }
 
@@ -137,7 +132,9 @@ Midi_walker::do_start_note (Midi_note *note)
 
       midi_events_.push_back (e.val);
       e.key = stop_ticks;
+      e.pitch_ = pitch;
       stop_note_queue.insert (e);
+      playing_notes_[pitch] = e;
 
       output_event (now_ticks, note);
     }
@@ -149,10 +146,14 @@ Midi_walker::do_stop_notes (int max_ticks)
   while (stop_note_queue.size () && stop_note_queue.front ().key <= max_ticks)
     {
       Midi_note_event e = stop_note_queue.get ();
-      if (e.ignore_)
+      auto playing = playing_notes_.find (e.pitch_);
+      if (playing == playing_notes_.end ()
+          || playing->second.val != e.val
+          || playing->second.key != e.key)
         {
           continue;
         }
+      playing_notes_.erase (playing);
 
       int stop_ticks = e.key;
       Midi_note *note = e.val;
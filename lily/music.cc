@@ -51,9 +51,14 @@ Preinit_Music::Preinit_Music ()
   start_callback_ = SCM_EOL;
 }
 
+/* The Prob counter includes all Music; count it separately for the
+   census.  */
+static Smob_counter music_counter ("Music", "Prob");
+
 Music::Music (SCM init)
   : Prob (ly_symbol2scm ("Music"), init)
 {
+  music_counter.add (sizeof (Music));
   length_callback_ = get_property (this, "length-callback");
   if (!ly_is_procedure (length_callback_))
     length_callback_ = duration_length_callback_proc;
@@ -83,10 +88,16 @@ Music::type_check_assignment (SCM s, SCM v) const
 Music::Music (Music const &m)
   : Prob (m)
 {
+  music_counter.add (sizeof (Music));
   length_callback_ = m.length_callback_;
   start_callback_ = m.start_callback_;
 }
 
+Music::~Music ()
+{
+  music_counter.remove (sizeof (Music));
+}
+
 Moment
 Music::get_length () const
 {
@@ -281,7 +281,7 @@ SCM
 Open_type_font::make_otf (const string &str)
 {
   FT_Face face = open_ft_face (str, 0 /* index */);
-  Open_type_font *otf = new Open_type_font (face);
+  Open_type_font *otf = new Open_type_font (face, str);
 
   return otf->self_scm ();
 }
@@ -294,14 +294,17 @@ Preinit_Open_type_font::Preinit_Open_type_font ()
   lily_index_to_bbox_table_ = SCM_EOL;
 }
 
-Open_type_font::Open_type_font (FT_Face face)
+Open_type_font::Open_type_font (FT_Face face, const string &file_name)
 {
   face_ = face;
 
   lily_character_table_ = alist_to_hashq (load_scheme_table ("LILC", face_));
   lily_global_table_ = alist_to_hashq (load_scheme_table ("LILY", face_));
   lily_subfonts_ = load_scheme_table ("LILF", face_);
-  index_to_charcode_map_ = make_index_to_charcode_map (face_);
+  if (metric_cache_.fill (file_name, 0, face_))
+    index_to_charcode_map_ = metric_cache_.index_to_charcode_map ();
+  else
+    index_to_charcode_map_ = make_index_to_charcode_map (face_);
 
   lily_index_to_bbox_table_ = scm_c_make_hash_table (257);
 
@@ -349,11 +352,16 @@ Open_type_font::get_indexed_char_dimensions (size_t signed_idx) const
     {
       const size_t len = 256;
       char name[len];
-      FT_Error code = FT_Get_Glyph_Name (face_, FT_UInt (signed_idx),
-                                         name, FT_UInt (len));
-      if (code)
-        warning (_f ("FT_Get_Glyph_Name () Freetype error: %s",
-                     freetype_error_string (code)));
+      if (Font_metric_cache::Glyph const *g = metric_cache_.glyph (signed_idx))
+        snprintf (name, len, "%s", g->name_.c_str ());
+      else
+        {
+          FT_Error code = FT_Get_Glyph_Name (face_, FT_UInt (signed_idx),
+                                             name, FT_UInt (len));
+          if (code)
+            warning (_f ("FT_Get_Glyph_Name () Freetype error: %s",
+                         freetype_error_string (code)));
+        }
 
       SCM sym = ly_symbol2scm (name);
       SCM alist = scm_hashq_ref (lily_character_table_, sym, SCM_BOOL_F);
@@ -396,6 +404,9 @@ Open_type_font::get_units_per_EM () const
 size_t
 Open_type_font::name_to_index (string nm) const
 {
+  if (metric_cache_.is_filled ())
+    return metric_cache_.name_to_index (nm);
+
   auto it = name_to_index_map_.find (nm);
   if (it != name_to_index_map_.end ())
     {
@@ -412,12 +423,16 @@ Open_type_font::name_to_index (string nm) const
 Box
 Open_type_font::get_unscaled_indexed_char_dimensions (size_t signed_idx) const
 {
+  if (Font_metric_cache::Glyph const *g = metric_cache_.glyph (signed_idx))
+    return g->dimensions_;
   return ly_FT_get_unscaled_indexed_char_dimensions (face_, signed_idx);
 }
 
 Box
 Open_type_font::get_glyph_outline_bbox (size_t signed_idx) const
 {
+  if (Font_metric_cache::Glyph const *g = metric_cache_.glyph (signed_idx))
+    return g->outline_bbox_;
   return ly_FT_get_glyph_outline_bbox (face_, signed_idx);
 }
 
@@ -502,6 +517,17 @@ Open_type_font::glyph_list () const
   SCM retval = SCM_EOL;
   SCM *tail = &retval;
 
+  if (metric_cache_.is_filled ())
+    {
+      for (size_t i = 0; i < metric_cache_.glyph_count (); i++)
+        {
+          *tail = scm_cons (ly_string2scm (metric_cache_.glyph (i)->name_),
+                            SCM_EOL);
+          tail = SCM_CDRLOC (*tail);
+        }
+      return retval;
+    }
+
   for (int i = 0; i < face_->num_glyphs; i++)
     {
       const size_t len = 256;
@@ -0,0 +1,336 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "output-cache.hh"
+
+#include "file-name.hh"
+#include "file-path.hh"
+#include "international.hh"
+#include "lily-guile.hh"
+#include "lily-version.hh"
+#include "main.hh"
+#include "program-option.hh"
+#include "source-file.hh"
+#include "sources.hh"
+#include "warn.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using std::pair;
+using std::string;
+using std::vector;
+
+/* Bump this when changing the format of the manifest. */
+static const char manifest_magic[] = "LYOC 1";
+
+/* Options that do not change the output. */
+static char const *const ignored_options[] =
+{
+  "log-file",
+  "output-cache",
+  "phase-timeline",
+  "separate-log-files",
+  "smob-census",
+  "trace-event-limit",
+  "trace-events",
+};
+
+bool Output_cache::recording_ = false;
+vector<string> Output_cache::outputs_;
+
+static bool
+read_file (string const &file_name, string *contents)
+{
+  FILE *f = fopen (file_name.c_str (), "rb");
+  if (!f)
+    return false;
+
+  contents->clear ();
+  char buf[1 << 16];
+  size_t n;
+  while ((n = fread (buf, 1, sizeof (buf), f)) > 0)
+    contents->append (buf, n);
+  bool ok = !ferror (f);
+  fclose (f);
+  return ok;
+}
+
+static bool
+write_file (string const &file_name, string const &contents)
+{
+  FILE *f = fopen (file_name.c_str (), "wb");
+  if (!f)
+    return false;
+  bool ok = fwrite (contents.data (), 1, contents.size (), f)
+            == contents.size ();
+  ok = (fclose (f) == 0) && ok;
+  return ok;
+}
+
+/* Write through a private file, so concurrent runs never see a
+   partial file.  */
+static bool
+replace_file (string const &file_name, string const &contents)
+{
+  string tmp_file = file_name + "." + std::to_string (getpid ());
+  if (write_file (tmp_file, contents)
+      && rename_file (tmp_file.c_str (), file_name.c_str ()))
+    return true;
+  remove (tmp_file.c_str ());
+  return false;
+}
+
+static string
+absolute_file_name (string const &file_name)
+{
+  if (File_name (file_name).is_absolute ())
+    return file_name;
+  return get_working_directory () + "/" + file_name;
+}
+
+string
+Output_cache::fingerprint (string const &data)
+{
+  /* Two independent 64-bit FNV-1a hashes.  */
+  uint64_t h1 = 14695981039346656037ULL;
+  uint64_t h2 = 0x84222325cbf29ce4ULL;
+  for (unsigned char c : data)
+    {
+      h1 = (h1 ^ c) * 1099511628211ULL;
+      h2 = (h2 ^ c) * 0x100000001b3ULL + 0x9e3779b97f4a7c15ULL;
+    }
+
+  char hex[33];
+  snprintf (hex, sizeof (hex), "%016llx%016llx",
+            static_cast<unsigned long long> (h1),
+            static_cast<unsigned long long> (h2));
+  return hex;
+}
+
+string
+Output_cache::file_fingerprint (string const &file_name)
+{
+  string contents;
+  if (!read_file (file_name, &contents))
+    return "";
+  return fingerprint (contents);
+}
+
+string
+Output_cache::directory ()
+{
+  SCM dir = ly_get_option (ly_symbol2scm ("output-cache"));
+  string name;
+  if (scm_is_string (dir))
+    name = ly_scm2string (dir);
+  else if (scm_is_symbol (dir))
+    name = ly_symbol2string (dir);
+  if (name.empty ())
+    return "";
+
+  if (!is_dir (name) && mkdir (name.c_str (), 0777) != 0)
+    {
+      warning (_f ("cannot create output cache directory: %s",
+                   name.c_str ()));
+      return "";
+    }
+  return absolute_file_name (name);
+}
+
+Output_cache::Output_cache (string const &dir, string const &input_file,
+                            string const &out_file)
+  : dir_ (dir)
+{
+  if (input_file == "-")
+    dir_ = "";
+  outputs_.clear ();
+  recording_ = !dir_.empty ();
+  if (dir_.empty ())
+    return;
+
+  vector<pair<string, string> > options;
+  for (SCM s = ly_all_options (); scm_is_pair (s); s = scm_cdr (s))
+    {
+      string name = ly_symbol2string (scm_caar (s));
+      if (std::find (std::begin (ignored_options), std::end (ignored_options),
+                     name)
+          == std::end (ignored_options))
+        options.push_back ({name, ly_scm_write_string (scm_cdar (s))});
+    }
+  std::sort (options.begin (), options.end ());
+
+  string job = version_string () + "\n"
+               + absolute_file_name (input_file) + "\n"
+               + absolute_file_name (out_file) + "\n"
+               + output_format_global + "\n"
+               + init_name_global + "\n"
+               + init_scheme_code_global + "\n"
+               + global_path.to_string () + "\n";
+  for (pair<string, string> const &option : options)
+    job += option.first + "=" + option.second + "\n";
+  key_ = fingerprint (job);
+}
+
+string
+Output_cache::manifest_name () const
+{
+  return dir_ + "/" + key_ + ".manifest";
+}
+
+string
+Output_cache::blob_name (string const &fingerprint) const
+{
+  return dir_ + "/" + fingerprint + ".blob";
+}
+
+bool
+Output_cache::restore () const
+{
+  if (dir_.empty ())
+    return false;
+
+  string manifest;
+  if (!read_file (manifest_name (), &manifest))
+    return false;
+
+  vector<pair<string, string> > outputs;
+  ssize start = 0;
+  bool header = true;
+  while (start < ssize (manifest.length ()))
+    {
+      ssize end = manifest.find ('\n', start);
+      if (end == NPOS)
+        end = manifest.length ();
+      string line = manifest.substr (start, end - start);
+      start = end + 1;
+
+      if (header)
+        {
+          if (line != manifest_magic)
+            return false;
+          header = false;
+          continue;
+        }
+
+      // KIND FINGERPRINT FILE-NAME
+      ssize sep1 = line.find (' ');
+      ssize sep2 = sep1 == NPOS ? NPOS : line.find (' ', sep1 + 1);
+      if (sep2 == NPOS)
+        return false;
+      string kind = line.substr (0, sep1);
+      string print = line.substr (sep1 + 1, sep2 - sep1 - 1);
+      string file = line.substr (sep2 + 1);
+
+      if (kind == "input")
+        {
+          if (file_fingerprint (file) != print)
+            {
+              debug_output (_f ("Output cache miss, changed: %s",
+                                file.c_str ()));
+              return false;
+            }
+        }
+      else if (kind == "output")
+        outputs.push_back ({print, file});
+      else
+        return false;
+    }
+
+  if (outputs.empty ())
+    return false;
+
+  for (pair<string, string> const &output : outputs)
+    {
+      string contents;
+      if (!read_file (blob_name (output.first), &contents))
+        return false;
+      if (!write_file (output.second, contents))
+        {
+          warning (_f ("cannot write cached output: %s",
+                       output.second.c_str ()));
+          return false;
+        }
+      debug_output (_f ("Output cache: restored %s",
+                        output.second.c_str ()));
+    }
+  return true;
+}
+
+void
+Output_cache::note_output (string const &file_name)
+{
+  if (recording_)
+    outputs_.push_back (absolute_file_name (file_name));
+}
+
+void
+Output_cache::store (Sources const &sources) const
+{
+  recording_ = false;
+  if (dir_.empty ())
+    return;
+
+  string manifest = string (manifest_magic) + "\n";
+  vector<string> inputs;
+  for (Source_file *f : sources.files ())
+    {
+      string file = absolute_file_name (f->name_string ());
+      string print = file_fingerprint (file);
+      if (print.empty ())
+        return;
+      manifest += "input " + print + " " + file + "\n";
+      inputs.push_back (file);
+    }
+
+  vector<string> outputs = outputs_;
+  std::sort (outputs.begin (), outputs.end ());
+  outputs.erase (std::unique (outputs.begin (), outputs.end ()),
+                 outputs.end ());
+  bool stored = false;
+  for (string const &file : outputs)
+    {
+      if (!is_file (file)
+          || std::find (inputs.begin (), inputs.end (), file) != inputs.end ()
+          || file.compare (0, dir_.length () + 1, dir_ + "/") == 0)
+        continue;
+
+      string contents;
+      if (!read_file (file, &contents))
+        return;
+      string print = fingerprint (contents);
+      string blob = blob_name (print);
+      if (!is_file (blob) && !replace_file (blob, contents))
+        {
+          warning (_f ("cannot write output cache: %s", blob.c_str ()));
+          return;
+        }
+      manifest += "output " + print + " " + file + "\n";
+      stored = true;
+    }
+
+  if (!stored)
+    return;
+  if (!replace_file (manifest_name (), manifest))
+    warning (_f ("cannot write output cache: %s",
+                 manifest_name ().c_str ()));
+}
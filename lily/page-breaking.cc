@@ -292,6 +292,12 @@ Page_breaking::Page_breaking (Paper_book *pb, Break_predicate is_break, Prob_bre
 
 Page_breaking::~Page_breaking ()
 {
+  Grob::report_pure_cache_statistics ();
+
+  for (vsize i = 0; i < system_specs_.size (); i++)
+    if (Paper_score *ps = system_specs_[i].pscore_)
+      if (System *sys = ps->root_system ())
+        sys->clear_pure_caches ();
 }
 
 bool
@@ -133,6 +133,15 @@ Page_turn_page_breaking::total_page_count (Break_node const &b)
   return end - 1 + (end % 2) - b.first_page_number_;
 }
 
+/* A lower bound on the demerits of any Break_node that starts at START.
+   Page demerits are never negative, so every solution starting at START
+   costs at least as much as the best solution ending just before it. */
+Real
+Page_turn_page_breaking::demerits_lower_bound (vsize start) const
+{
+  return start > 0 ? state_[start - 1].demerits_ : 0.0;
+}
+
 extern bool debug_page_breaking_scoring;
 
 void
@@ -144,15 +153,38 @@ Page_turn_page_breaking::calc_subproblem (vsize ending_breakpoint)
   Break_node this_start_best;
   vsize prev_best_system_count = 0;
 
-  for (vsize start = end; start--;)
-    {
-      if (start < end - 1
-          && scm_is_eq (breakpoint_property (start + 1, "page-turn-permission"),
-                        ly_symbol2scm ("force")))
+  /* Starts before a forced page turn are never reached.  For the remaining
+     starts, record the smallest lower bound at or below each of them so
+     that we can stop scanning once no earlier start can improve BEST. */
+  vsize first_start = 0;
+  for (vsize start = end - 1; start-- > 0;)
+    if (scm_is_eq (breakpoint_property (start + 1, "page-turn-permission"),
+                   ly_symbol2scm ("force")))
+      {
+        first_start = start + 1;
         break;
+      }
 
-      if (start > 0 && best.demerits_ < state_[start - 1].demerits_)
-        continue;
+  vector<Real> min_lower_bound (end, infinity_f);
+  for (vsize start = first_start; start < end; start++)
+    {
+      min_lower_bound[start] = demerits_lower_bound (start);
+      if (start > first_start)
+        min_lower_bound[start] = std::min (min_lower_bound[start],
+                                           min_lower_bound[start - 1]);
+    }
+
+  for (vsize start = end; start-- > first_start;)
+    {
+      /* A start whose lower bound exceeds BEST cannot contribute.  Starts
+         that only tie BEST are still visited, since they may raise
+         prev_best_system_count. */
+      if (demerits_lower_bound (start) > best.demerits_)
+        {
+          stats_.starts_pruned_++;
+          continue;
+        }
+      stats_.starts_explored_++;
 
       int p_num = from_scm (book_->paper_->c_variable ("first-page-number"), 1);
       if (start > 0)
@@ -186,8 +218,10 @@ Page_turn_page_breaking::calc_subproblem (vsize ending_breakpoint)
           set_current_breakpoints (start, end, sys_count, min_division, max_division);
           bool found = false;
 
+          stats_.system_counts_explored_++;
           for (vsize i = 0; i < current_configuration_count (); i++)
             {
+              stats_.configurations_explored_++;
               cur = put_systems_on_pages (start, end, i, p_num);
 
               if (std::isinf (cur.demerits_)
@@ -231,6 +265,14 @@ Page_turn_page_breaking::calc_subproblem (vsize ending_breakpoint)
 
       if (this_start_best.demerits_ < best.demerits_)
         best = this_start_best;
+
+      /* Nothing earlier can reach a solution that already costs less
+         than the cheapest prefix still to be visited. */
+      if (start > first_start && best.demerits_ < min_lower_bound[start - 1])
+        {
+          stats_.starts_pruned_ += start - first_start;
+          break;
+        }
     }
   state_.push_back (best);
 }
@@ -239,6 +281,7 @@ SCM
 Page_turn_page_breaking::solve ()
 {
   state_.clear ();
+  stats_ = Search_stats ();
   message (_f ("Calculating page and line breaks (%d possible page breaks)...",
                (int) last_break_position ()));
   for (vsize i = 0; i < last_break_position (); i++)
@@ -248,6 +291,12 @@ Page_turn_page_breaking::solve ()
     }
   progress_indication ("\n");
 
+  debug_output (_f ("page-turn-page-breaking: explored %zu starts"
+                    " (%zu pruned), %zu system counts, %zu configurations",
+                    stats_.starts_explored_, stats_.starts_pruned_,
+                    stats_.system_counts_explored_,
+                    stats_.configurations_explored_));
+
   vector<Break_node> breaking;
   int i = static_cast<int> (state_.size ()) - 1;
   while (i >= 0)
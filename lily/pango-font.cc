@@ -43,6 +43,9 @@
 
 using std::string;
 
+size_t Pango_font::text_cache_hits_ = 0;
+size_t Pango_font::text_cache_misses_ = 0;
+
 // RAII for extracting FT_Face from PangoFcFont
 class FTFace_accessor
 {
@@ -145,6 +148,8 @@ void
 Pango_font::derived_mark () const
 {
   scm_gc_mark (physical_font_tab_);
+  for (Text_cache_entry const &entry : text_cache_)
+    scm_gc_mark (entry.stencil_.expr ());
 }
 
 void
@@ -419,6 +424,87 @@ Pango_font::text_stencil (Output_def * /* state */,
                           const string &str,
                           bool music_string,
                           const string &features_str) const
+{
+  /* Features never contain a NUL, so this key is unambiguous. */
+  string key = features_str;
+  key += '\0';
+  key += str;
+
+  Stencil dest;
+  auto it = text_cache_index_.find (key);
+  if (it != text_cache_index_.end ())
+    {
+      text_cache_hits_++;
+      text_cache_.splice (text_cache_.begin (), text_cache_, it->second);
+      dest = it->second->stencil_;
+    }
+  else
+    {
+      text_cache_misses_++;
+      dest = layout_text (str, features_str);
+      if (text_cache_.size () >= text_cache_size_)
+        {
+          text_cache_index_.erase (text_cache_.back ().key_);
+          text_cache_.pop_back ();
+        }
+      text_cache_.push_front (Text_cache_entry {key, dest});
+      text_cache_index_[key] = text_cache_.begin ();
+    }
+
+  string name = get_output_backend_name ();
+  string output_mod = "scm output-" + name;
+  SCM mod = scm_c_resolve_module (output_mod.c_str ());
+
+  bool has_utf8_string = false;
+
+  if (ly_is_module (mod))
+    {
+      SCM utf8_string = ly_module_lookup (mod, ly_symbol2scm ("utf-8-string"));
+      /*
+        has_utf8_string should only be true when utf8_string is a
+        variable that is bound to a *named* procedure, i.e. not a
+        lambda expression.
+      */
+      if (scm_is_true (utf8_string)
+          && scm_is_true (scm_procedure_name (SCM_VARIABLE_REF (utf8_string))))
+        has_utf8_string = true;
+    }
+
+  bool to_paths = music_strings_to_paths;
+
+  /*
+    Backends with the utf-8-string expression use it when
+      1) the -dmusic-strings-to-paths option is set
+         and `str' is not a music string, or
+      2) the -dmusic-strings-to-paths option is not set.
+  */
+  if (has_utf8_string && ((to_paths && !music_string) || !to_paths))
+    {
+      // For Pango based backends, we take a shortcut.
+      SCM exp = scm_list_4 (ly_symbol2scm ("utf-8-string"),
+                            ly_string2scm (description_string ()),
+                            ly_string2scm (str),
+                            dest.expr ());
+
+      Box b (Interval (0, 0), Interval (0, 0));
+      b.unite (dest.extent_box ());
+      return Stencil (b, exp);
+    }
+
+  return dest;
+}
+
+void
+Pango_font::report_text_cache_statistics ()
+{
+  if (text_cache_hits_ || text_cache_misses_)
+    debug_output (_f ("Text stencil cache: %zu hits, %zu misses",
+                      text_cache_hits_, text_cache_misses_));
+}
+
+/* Lay out TEXT with Pango, without the backend-specific wrapping. */
+Stencil
+Pango_font::layout_text (const string &str, const string &features_str) const
 {
   /*
     The text assigned to a PangoLayout is automatically divided
@@ -476,46 +562,6 @@ Pango_font::text_stencil (Output_def * /* state */,
         }
     }
 
-  string name = get_output_backend_name ();
-  string output_mod = "scm output-" + name;
-  SCM mod = scm_c_resolve_module (output_mod.c_str ());
-
-  bool has_utf8_string = false;
-
-  if (ly_is_module (mod))
-    {
-      SCM utf8_string = ly_module_lookup (mod, ly_symbol2scm ("utf-8-string"));
-      /*
-        has_utf8_string should only be true when utf8_string is a
-        variable that is bound to a *named* procedure, i.e. not a
-        lambda expression.
-      */
-      if (scm_is_true (utf8_string)
-          && scm_is_true (scm_procedure_name (SCM_VARIABLE_REF (utf8_string))))
-        has_utf8_string = true;
-    }
-
-  bool to_paths = music_strings_to_paths;
-
-  /*
-    Backends with the utf-8-string expression use it when
-      1) the -dmusic-strings-to-paths option is set
-         and `str' is not a music string, or
-      2) the -dmusic-strings-to-paths option is not set.
-  */
-  if (has_utf8_string && ((to_paths && !music_string) || !to_paths))
-    {
-      // For Pango based backends, we take a shortcut.
-      SCM exp = scm_list_4 (ly_symbol2scm ("utf-8-string"),
-                            ly_string2scm (description_string ()),
-                            ly_string2scm (str),
-                            dest.expr ());
-
-      Box b (Interval (0, 0), Interval (0, 0));
-      b.unite (dest.extent_box ());
-      return Stencil (b, exp);
-    }
-
   return dest;
 }
 
@@ -23,9 +23,11 @@
 #include "international.hh"
 #include "main.hh"
 #include "output-def.hh"
+#include "pango-font.hh"
 #include "paper-column.hh"
 #include "paper-score.hh"
 #include "paper-system.hh"
+#include "phase-timeline.hh"
 #include "text-interface.hh"
 #include "warn.hh"
 #include "program-option.hh"
@@ -149,13 +151,33 @@ Paper_book::output_aux (SCM output_channel,
       /* Generate all stencils to trigger font loads.  */
       page_nb = scm_ilength (pages ());
       *first_page_number += page_nb;
+
+      /* The system clipping of -dclip-systems still needs the
+         columns.  */
+      if (get_program_option ("release-layout")
+          && !get_program_option ("clip-systems"))
+        release_layout ();
     }
   return page_nb;
 }
 
+/*
+  Drop the grobs' layout data of our scores, keeping the page stencils
+  and the label table, which is all the output needs.  Then the memory
+  for layout no longer grows with the number of bookparts.
+*/
+void
+Paper_book::release_layout ()
+{
+  for (SCM s = scores_; scm_is_pair (s); s = scm_cdr (s))
+    if (Paper_score *pscore = unsmob<Paper_score> (scm_car (s)))
+      pscore->release_layout ();
+}
+
 void
 Paper_book::output (SCM output_channel)
 {
+  Phase_timeline::Scope phase ("output");
   long first_page_number
     = from_scm (paper_->c_variable ("first-page-number"), 1);
   long first_performance_number = 0;
@@ -176,6 +198,8 @@ Paper_book::output (SCM output_channel)
                    &first_performance_number))
     return;
 
+  Pango_font::report_text_cache_statistics ();
+
   SCM scopes = SCM_EOL;
   if (ly_is_module (header_))
     scopes = scm_cons (header_, scopes);
@@ -261,6 +285,7 @@ Paper_book::classic_output_aux (SCM output,
 void
 Paper_book::classic_output (SCM output)
 {
+  Phase_timeline::Scope phase ("output");
   long first_performance_number = 0;
   classic_output_aux (output, &first_performance_number);
 
@@ -652,7 +677,9 @@ Paper_book::pages ()
   else if (scm_is_pair (scores_))
     {
       SCM page_breaking = paper_->c_variable ("page-breaking");
+      vsize phase = Phase_timeline::begin ("page-breaking");
       pages_ = scm_call_1 (page_breaking, self_scm ());
+      Phase_timeline::end (phase);
 
       // Create all the page stencils.
       SCM page_module = scm_c_resolve_module ("scm page");
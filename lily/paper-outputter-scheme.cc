@@ -59,6 +59,22 @@ LY_DEFINE (ly_outputter_dump_stencil, "ly:outputter-dump-stencil",
   Stencil *st = unsmob<Stencil> (stencil);
 
   po->output_stencil (*st);
+  po->flush ();
+  return SCM_UNSPECIFIED;
+}
+
+LY_DEFINE (ly_outputter_use_native_ps, "ly:outputter-use-native-ps",
+           2, 0, 0, (SCM outputter, SCM font_command),
+           "Let @var{outputter} write the most common PostScript stencil"
+           " commands itself instead of calling the backend.  The"
+           " procedure @var{font-command} maps a font to the name of its"
+           " PostScript font command.")
+{
+  LY_ASSERT_SMOB (Paper_outputter, outputter, 1);
+  LY_ASSERT_TYPE (ly_is_procedure, font_command, 2);
+
+  Paper_outputter *po = unsmob<Paper_outputter> (outputter);
+  po->use_native_ps (font_command);
   return SCM_UNSPECIFIED;
 }
 
@@ -71,7 +87,9 @@ LY_DEFINE (ly_outputter_dump_string, "ly:outputter-dump-string",
 
   Paper_outputter *po = unsmob<Paper_outputter> (outputter);
 
-  return po->dump_string (str);
+  SCM result = po->dump_string (str);
+  po->flush ();
+  return result;
 }
 
 LY_DEFINE (ly_outputter_port, "ly:outputter-port",
@@ -103,6 +121,7 @@ LY_DEFINE (ly_outputter_output_scheme, "ly:outputter-output-scheme", 2, 0, 0,
   Paper_outputter *po = unsmob<Paper_outputter> (outputter);
 
   po->output_scheme (expr);
+  po->flush ();
 
   return SCM_UNSPECIFIED;
 }
@@ -21,6 +21,7 @@
 #include "paper-outputter.hh"
 
 #include "dimensions.hh"
+#include "display-list.hh"
 #include "file-name.hh"
 #include "font-metric.hh"
 #include "input.hh"
@@ -28,6 +29,7 @@
 #include "lily-imports.hh"
 #include "lily-version.hh"
 #include "main.hh"
+#include "output-cache.hh"
 #include "output-def.hh"
 #include "paper-book.hh"
 #include "paper-system.hh"
@@ -44,6 +46,12 @@ using std::string;
 Paper_outputter::Paper_outputter (SCM port, SCM alist, SCM default_callback)
 {
   file_ = port;
+  SCM file_name = scm_port_filename (port);
+  if (scm_is_string (file_name))
+    Output_cache::note_output (ly_scm2string (file_name));
+  pending_length_ = 0;
+  bytes_written_ = 0;
+  write_time_ = 0.0;
   callback_tab_ = SCM_EOL;
   default_callback_ = SCM_EOL;
   smobify_self ();
@@ -63,25 +71,98 @@ Paper_outputter::mark_smob () const
 {
   scm_gc_mark (callback_tab_);
   scm_gc_mark (default_callback_);
+  if (ps_emitter_)
+    ps_emitter_->mark ();
+  for (SCM s : pending_)
+    scm_gc_mark (s);
   return file_;
 }
 
+/* Callers may write to the port directly, so hand it out only after
+   writing what we have. */
 SCM
-Paper_outputter::file () const
+Paper_outputter::file ()
 {
+  flush ();
   return file_;
 }
 
+/*
+  Output strings are collected and written in blocks of at least this
+  many characters, instead of one port write per stencil command.
+*/
+static const size_t flush_threshold = 1 << 16;
+
 SCM
 Paper_outputter::dump_string (SCM scm)
 {
-  return scm_display (scm, file ());
+  if (!scm_is_string (scm))
+    return scm_display (scm, file ());
+
+  pending_.push_back (scm);
+  pending_length_ += scm_c_string_length (scm);
+  if (pending_length_ >= flush_threshold)
+    flush ();
+  return SCM_UNSPECIFIED;
+}
+
+void
+Paper_outputter::flush ()
+{
+  if (pending_.empty ())
+    return;
+
+  Cpu_timer::Scope scope ("output-write");
+  SCM strings = SCM_EOL;
+  for (vsize i = pending_.size (); i--;)
+    strings = scm_cons (pending_[i], strings);
+  pending_.clear ();
+
+  scm_display (scm_string_append (strings), file_);
+  bytes_written_ += pending_length_;
+  pending_length_ = 0;
+  write_time_ += scope.wall ();
+}
+
+void
+Paper_outputter::use_native_ps (SCM font_command_proc)
+{
+  ps_emitter_.reset (new Ps_emitter (font_command_proc));
+}
+
+/* Try to write (HEAD ARGV...) without calling into the backend. */
+bool
+Paper_outputter::output_native (SCM head, vsize argc, SCM const *argv)
+{
+  if (!ps_emitter_)
+    return false;
+
+  native_buffer_.clear ();
+  if (!ps_emitter_->emit (head, argc, argv, &native_buffer_))
+    return false;
+
+  if (!native_buffer_.empty ())
+    dump_string (scm_from_latin1_stringn (native_buffer_.data (),
+                                          native_buffer_.size ()));
+  return true;
 }
 
 SCM
 Paper_outputter::output_scheme (SCM expr)
 {
   SCM head = scm_car (expr);
+  if (ps_emitter_)
+    {
+      const vsize max_args = 8;
+      SCM argv[max_args];
+      vsize argc = 0;
+      SCM s = scm_cdr (expr);
+      for (; scm_is_pair (s) && argc < max_args; s = scm_cdr (s))
+        argv[argc++] = scm_car (s);
+      if (scm_is_null (s) && output_native (head, argc, argv))
+        return SCM_UNSPECIFIED;
+    }
+
   SCM callback = scm_hashq_ref (callback_tab_, head, SCM_BOOL_F);
   SCM result = SCM_BOOL_F;
   if (callback != SCM_BOOL_F)
@@ -100,6 +181,126 @@ Paper_outputter::output_scheme (SCM expr)
   return result;
 }
 
+/* Like output_scheme () on (HEAD ARGV...), but do not build the
+   expression if there is a callback for HEAD. */
+SCM
+Paper_outputter::output_command (SCM head, vsize argc, SCM const *argv)
+{
+  if (output_native (head, argc, argv))
+    return SCM_UNSPECIFIED;
+
+  SCM callback = scm_hashq_ref (callback_tab_, head, SCM_BOOL_F);
+  if (scm_is_false (callback))
+    {
+      if (scm_is_false (default_callback_))
+        return SCM_BOOL_F;
+
+      SCM expr = SCM_EOL;
+      for (vsize i = argc; i--;)
+        expr = scm_cons (argv[i], expr);
+      return output_scheme (scm_cons (head, expr));
+    }
+
+  SCM result = SCM_BOOL_F;
+  switch (argc)
+    {
+    case 0:
+      result = scm_call_0 (callback);
+      break;
+    case 1:
+      result = scm_call_1 (callback, argv[0]);
+      break;
+    case 2:
+      result = scm_call_2 (callback, argv[0], argv[1]);
+      break;
+    case 3:
+      result = scm_call_3 (callback, argv[0], argv[1], argv[2]);
+      break;
+    case 4:
+      result = scm_call_4 (callback, argv[0], argv[1], argv[2], argv[3]);
+      break;
+    default:
+      {
+        SCM args = SCM_EOL;
+        for (vsize i = argc; i--;)
+          args = scm_cons (argv[i], args);
+        result = scm_apply_0 (callback, args);
+      }
+    }
+  if (scm_is_string (result))
+    dump_string (result);
+  return result;
+}
+
+void
+Paper_outputter::output_display_list (Display_list const &list)
+{
+  SCM args[4];
+  for (auto const &item : list.items ())
+    {
+      switch (item.command_)
+        {
+        case Display_list::PRIMITIVE:
+          args[0] = to_scm (item.offset_[X_AXIS]);
+          args[1] = to_scm (item.offset_[Y_AXIS]);
+          output_command (ly_symbol2scm ("settranslation"), 2, args);
+          output_scheme (item.expr_);
+          output_command (ly_symbol2scm ("resettranslation"), 0, args);
+          break;
+        case Display_list::GROB_CAUSE:
+          args[0] = to_scm (item.offset_);
+          args[1] = item.expr_;
+          output_command (ly_symbol2scm ("grob-cause"), 2, args);
+          break;
+        case Display_list::NO_ORIGIN:
+          output_command (ly_symbol2scm ("no-origin"), 0, args);
+          break;
+        case Display_list::SET_COLOR:
+          {
+            SCM color = item.expr_;
+            vsize argc = 1;
+            if (scm_is_string (color))
+              args[0] = color;
+            else
+              {
+                argc = (scm_ilength (color) == 4) ? 4 : 3;
+                for (vsize i = 0; i < argc; i++, color = scm_cdr (color))
+                  args[i] = scm_car (color);
+              }
+            output_command (ly_symbol2scm ("setcolor"), argc, args);
+          }
+          break;
+        case Display_list::RESET_COLOR:
+          output_command (ly_symbol2scm ("resetcolor"), 0, args);
+          break;
+        case Display_list::START_GROUP:
+          args[0] = item.expr_;
+          output_command (ly_symbol2scm ("start-group-node"), 1, args);
+          break;
+        case Display_list::END_GROUP:
+          output_command (ly_symbol2scm ("end-group-node"), 0, args);
+          break;
+        case Display_list::SET_ROTATION:
+        case Display_list::RESET_ROTATION:
+          args[0] = item.expr_;
+          args[1] = to_scm (item.offset_[X_AXIS]);
+          args[2] = to_scm (item.offset_[Y_AXIS]);
+          output_command (item.command_ == Display_list::SET_ROTATION
+                          ? ly_symbol2scm ("setrotation")
+                          : ly_symbol2scm ("resetrotation"), 3, args);
+          break;
+        case Display_list::SET_SCALE:
+          args[0] = scm_car (item.expr_);
+          args[1] = scm_cadr (item.expr_);
+          output_command (ly_symbol2scm ("setscale"), 2, args);
+          break;
+        case Display_list::RESET_SCALE:
+          output_command (ly_symbol2scm ("resetscale"), 0, args);
+          break;
+        }
+    }
+}
+
 struct Scm_to_file : Stencil_sink
 {
   Paper_outputter *po_;
@@ -107,9 +308,20 @@ struct Scm_to_file : Stencil_sink
   virtual SCM output (SCM scm) override { return po_->output_scheme (scm); }
 };
 
+extern bool stencil_display_list;
+
 void
 Paper_outputter::output_stencil (Stencil stil)
 {
+  if (stencil_display_list)
+    {
+      Display_list list;
+      list.compile (stil.expr (), Offset (0, 0));
+      output_display_list (list);
+      scm_remember_upto_here_1 (stil.expr ());
+      return;
+    }
+
   Scm_to_file stf;
   stf.po_ = this;
 
@@ -119,11 +331,15 @@ Paper_outputter::output_stencil (Stencil stil)
 void
 Paper_outputter::close ()
 {
+  flush ();
   if (ly_is_port (file_))
     {
       scm_close_port (file_);
     }
 
   debug_output (
-    _f ("Paper_outputter elapsed time: %.2f seconds", timer_.read ()));
+    _f ("Paper_outputter elapsed time: %.2f seconds", timer_.wall ()));
+  debug_output (
+    _f ("Paper_outputter wrote %zu characters in %.2f seconds",
+        bytes_written_, write_time_));
 }
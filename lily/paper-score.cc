@@ -27,6 +27,8 @@
 #include "output-def.hh"
 #include "paper-book.hh"
 #include "paper-column.hh"
+#include "phase-timeline.hh"
+#include "prob.hh"
 #include "scm-hash.hh"
 #include "score.hh"
 #include "stencil.hh"
@@ -127,6 +129,7 @@ Paper_score::calc_breaking ()
 void
 Paper_score::process ()
 {
+  Phase_timeline::Scope phase ("pre-processing");
   debug_output (_f ("Element count %zu (spanners %zu) ",
                     system_->element_count (),
                     system_->spanner_count ()));
@@ -161,3 +164,23 @@ Paper_score::get_paper_systems ()
     }
   return paper_systems_;
 }
+
+/*
+  Once the pages are made, only the paper systems' stencils are still
+  needed.
+*/
+void
+Paper_score::release_layout ()
+{
+  if (system_)
+    system_->release_layout ();
+
+  cols_.clear ();
+  break_indices_.clear ();
+  break_ranks_.clear ();
+
+  if (scm_is_vector (paper_systems_))
+    for (size_t i = 0; i < scm_c_vector_length (paper_systems_); i++)
+      if (Prob *ps = unsmob<Prob> (scm_c_vector_ref (paper_systems_, i)))
+        set_property (ps, "vertical-skylines", SCM_EOL);
+}
@@ -0,0 +1,215 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "phase-timeline.hh"
+
+#include "grob.hh"
+#include "international.hh"
+#include "lily-guile.hh"
+#include "lily-version.hh"
+#include "smob-census.hh"
+#include "string-convert.hh"
+#include "trace.hh"
+#include "warn.hh"
+
+#include <cstdio>
+#ifndef __MINGW32__
+#include <sys/resource.h>
+#endif
+
+using std::string;
+using std::vector;
+
+vector<Phase_timeline::Record> Phase_timeline::records_;
+vector<Phase_timeline::Open_phase> Phase_timeline::open_;
+
+Phase_timeline::Clock::time_point
+Phase_timeline::origin ()
+{
+  static Clock::time_point start = Clock::now ();
+  return start;
+}
+
+static size_t
+gc_heap_size (SCM stats)
+{
+#if GUILEV2
+  char const *keys[] = {"heap-size"};
+#else
+  char const *keys[] = {"cell-heap-size", "bytes-malloced"};
+#endif
+  size_t total = 0;
+  for (char const *key : keys)
+    {
+      SCM size = scm_assq_ref (stats, ly_symbol2scm (key));
+      if (scm_is_integer (size))
+        total += scm_to_size_t (size);
+    }
+  return total;
+}
+
+/* Seconds spent in garbage collection so far.  */
+static Real
+gc_time (SCM stats)
+{
+  static Real units_per_second
+    = scm_to_double (scm_variable_ref
+                     (scm_c_lookup ("internal-time-units-per-second")));
+  SCM taken = scm_assq_ref (stats, ly_symbol2scm ("gc-time-taken"));
+  return scm_is_number (taken) ? scm_to_double (taken) / units_per_second
+         : 0.0;
+}
+
+/* Peak resident set size in kilobytes, or -1 if unknown.  */
+static long
+peak_rss ()
+{
+#ifndef __MINGW32__
+  struct rusage usage;
+  if (getrusage (RUSAGE_SELF, &usage) == 0)
+    return usage.ru_maxrss;
+#endif
+  return -1;
+}
+
+vsize
+Phase_timeline::begin (char const *name, string const &detail)
+{
+  Clock::time_point now = Clock::now ();
+
+  Record r;
+  r.name_ = name;
+  r.detail_ = detail;
+  r.depth_ = static_cast<int> (open_.size ());
+  r.start_ = std::chrono::duration<Real> (now - origin ()).count ();
+  r.wall_ = 0.0;
+  r.cpu_ = 0.0;
+  r.children_wall_ = 0.0;
+  r.gc_time_ = 0.0;
+  r.gc_heap_ = 0;
+  r.grobs_ = 0;
+  r.peak_rss_ = -1;
+
+  vsize index = records_.size ();
+  // The first phase starts before Guile does.
+  Real gc = scm_initialized_p ? gc_time (scm_gc_stats ()) : 0.0;
+  vsize timer_depth = Cpu_timer::begin_scope (name);
+  open_.push_back ({name, index, timer_depth, now,
+                    Cpu_timer::thread_cpu_time (), gc});
+  records_.push_back (r);
+  return index;
+}
+
+void
+Phase_timeline::end ()
+{
+  if (open_.empty ())
+    {
+      programming_error ("ending a phase that was never begun");
+      return;
+    }
+  close_innermost ();
+}
+
+void
+Phase_timeline::end (vsize index)
+{
+  while (!open_.empty () && open_.back ().index_ >= index)
+    close_innermost ();
+}
+
+void
+Phase_timeline::close_innermost ()
+{
+  Open_phase phase = open_.back ();
+  open_.pop_back ();
+
+  Cpu_timer::end_scope (phase.timer_depth_);
+  Clock::time_point now = Clock::now ();
+  if (trace_events)
+    Trace::record (Trace::PHASE, phase.name_, Trace::Label (), phase.start_,
+                   now);
+
+  Record &r = records_[phase.index_];
+  r.wall_ = std::chrono::duration<Real> (now - phase.start_).count ();
+  r.cpu_ = Cpu_timer::thread_cpu_time () - phase.start_cpu_;
+  SCM stats = scm_gc_stats ();
+  r.gc_time_ = gc_time (stats) - phase.start_gc_time_;
+  r.gc_heap_ = gc_heap_size (stats);
+  r.grobs_ = Grob::count_;
+  r.peak_rss_ = peak_rss ();
+
+  if (!open_.empty ())
+    records_[open_.back ().index_].children_wall_ += r.wall_;
+
+  if (smob_census)
+    Smob_census::take (phase.name_);
+}
+
+void
+Phase_timeline::write_json (string const &file_name)
+{
+  FILE *out = fopen (file_name.c_str (), "w");
+  if (!out)
+    {
+      warning (_f ("cannot write phase timeline: %s", file_name.c_str ()));
+      return;
+    }
+
+  fprintf (out, "{\n  \"version\": %s,\n  \"phases\": [",
+           String_convert::json_quote (version_string ()).c_str ());
+  for (vsize i = 0; i < records_.size (); i++)
+    {
+      Record const &r = records_[i];
+      fprintf (out, "%s\n    {\"name\": %s, \"detail\": %s, \"depth\": %d,"
+               " \"start\": %.6f, \"wall\": %.6f, \"self-wall\": %.6f,"
+               " \"cpu\": %.6f, \"gc-time\": %.6f, \"gc-heap\": %zu,"
+               " \"grobs\": %zu, \"peak-rss-kb\": %ld}",
+               i ? "," : "",
+               String_convert::json_quote (r.name_).c_str (),
+               String_convert::json_quote (r.detail_).c_str (),
+               r.depth_, r.start_, r.wall_, r.wall_ - r.children_wall_,
+               r.cpu_, r.gc_time_, r.gc_heap_, r.grobs_, r.peak_rss_);
+    }
+  fprintf (out, "\n  ],\n  \"totals\": {");
+  bool first = true;
+  for (auto const &entry : Cpu_timer::totals ())
+    {
+      Cpu_timer::Total const &t = entry.second;
+      fprintf (out, "%s\n    %s: {\"count\": %zu, \"wall\": %.6f,"
+               " \"cpu\": %.6f, \"self-wall\": %.6f}",
+               first ? "" : ",",
+               String_convert::json_quote (entry.first).c_str (),
+               t.count_, t.wall_, t.cpu_, t.self_wall_);
+      first = false;
+    }
+  fprintf (out, "\n  }\n}\n");
+  if (fclose (out) != 0)
+    warning (_f ("cannot write phase timeline: %s", file_name.c_str ()));
+}
+
+LY_DEFINE (ly_write_phase_timeline, "ly:write-phase-timeline",
+           1, 0, 0, (SCM file_name),
+           "Write the times and memory use of the processing phases"
+           " so far to @var{file-name}, in JSON format.")
+{
+  LY_ASSERT_TYPE (scm_is_string, file_name, 1);
+  Phase_timeline::write_json (ly_scm2string (file_name));
+  return SCM_UNSPECIFIED;
+}
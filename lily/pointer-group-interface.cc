@@ -76,6 +76,7 @@ Pointer_group_interface::add_grob (Grob *me, SCM sym, Grob *p)
 {
   Grob_array *arr = get_grob_array (me, sym);
   arr->add (p);
+  me->flush_pure_cache ();
 }
 
 void
@@ -84,6 +85,7 @@ Pointer_group_interface::add_unordered_grob (Grob *me, SCM sym, Grob *p)
   Grob_array *arr = get_grob_array (me, sym);
   arr->add (p);
   arr->set_ordered (false);
+  me->flush_pure_cache ();
 }
 
 static vector<Grob *> empty_array;
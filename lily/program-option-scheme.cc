@@ -24,6 +24,8 @@
 #include "main.hh"
 #include "parse-scm.hh"
 #include "string-convert.hh"
+#include "smob-census.hh"
+#include "trace.hh"
 #include "warn.hh"
 #include "lily-imports.hh"
 #include "protected-scm.hh"
@@ -39,6 +41,7 @@ bool debug_property_callbacks;
 bool debug_page_breaking_scoring;
 
 bool music_strings_to_paths;
+bool stencil_display_list;
 bool relative_includes;
 
 bool profile_property_accesses = false;
@@ -125,6 +128,18 @@ internal_set_option (SCM var,
       music_strings_to_paths = valbool;
       val = val_scm_bool;
     }
+  else if (varstr == "stencil-display-list")
+    {
+      stencil_display_list = valbool;
+      val = val_scm_bool;
+    }
+  else if (varstr == "smob-census")
+    {
+      smob_census = valbool;
+      val = val_scm_bool;
+    }
+  else if (varstr == "trace-events")
+    trace_events = scm_is_string (val) || scm_is_symbol (val);
 
   scm_hashq_set_x (option_hash, var, val);
 }
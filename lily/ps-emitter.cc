@@ -0,0 +1,188 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ps-emitter.hh"
+
+#include "program-option.hh"
+
+using std::string;
+
+/*
+  Arithmetic is done with the Scheme procedures so that exact and
+  inexact arguments produce the same numbers as in output-ps.scm.
+*/
+
+// ~4f
+static void
+add_number (string *out, SCM x)
+{
+  *out += format_single_argument (x, 4);
+}
+
+// ~4l
+static void
+add_numbers (string *out, vsize n, SCM const *xs)
+{
+  for (vsize i = 0; i < n; i++)
+    {
+      if (i)
+        *out += ' ';
+      add_number (out, xs[i]);
+    }
+}
+
+static bool
+all_numbers (vsize argc, SCM const *argv)
+{
+  for (vsize i = 0; i < argc; i++)
+    if (!scm_is_number (argv[i]))
+      return false;
+  return true;
+}
+
+Ps_emitter::Ps_emitter (SCM font_command_proc)
+{
+  font_command_proc_ = font_command_proc;
+  font_commands_ = scm_c_make_hash_table (11);
+  music_font_encodings_ = get_program_option ("music-font-encodings");
+}
+
+void
+Ps_emitter::mark () const
+{
+  scm_gc_mark (font_command_proc_);
+  scm_gc_mark (font_commands_);
+}
+
+string
+Ps_emitter::font_command (SCM font)
+{
+  SCM cmd = scm_hashq_ref (font_commands_, font, SCM_BOOL_F);
+  if (!scm_is_string (cmd))
+    {
+      cmd = scm_call_1 (font_command_proc_, font);
+      scm_hashq_set_x (font_commands_, font, cmd);
+    }
+  return ly_scm2string (cmd);
+}
+
+bool
+Ps_emitter::emit (SCM head, vsize argc, SCM const *argv, string *out)
+{
+  if (scm_is_eq (head, ly_symbol2scm ("settranslation")))
+    {
+      if (argc != 2 || !all_numbers (argc, argv))
+        return false;
+      *out += ' ';
+      add_number (out, argv[0]);
+      *out += ' ';
+      add_number (out, argv[1]);
+      *out += " moveto\n";
+      return true;
+    }
+  else if (scm_is_eq (head, ly_symbol2scm ("draw-line")))
+    {
+      // thick x1 y1 x2 y2
+      if (argc != 5 || !all_numbers (argc, argv))
+        return false;
+      SCM xs[5] = {scm_difference (argv[3], argv[1]),
+                   scm_difference (argv[4], argv[2]),
+                   argv[1], argv[2], argv[0]
+                  };
+      add_numbers (out, 5, xs);
+      *out += " draw_line\n";
+      return true;
+    }
+  else if (scm_is_eq (head, ly_symbol2scm ("round-filled-box")))
+    {
+      // left right bottom top blotdiam
+      if (argc != 5 || !all_numbers (argc, argv))
+        return false;
+      SCM halfblot = scm_divide (argv[4], scm_from_int (2));
+      SCM x = scm_difference (halfblot, argv[0]);
+      SCM width = scm_difference (argv[1], scm_sum (halfblot, x));
+      SCM y = scm_difference (halfblot, argv[2]);
+      SCM height = scm_difference (argv[3], scm_sum (halfblot, y));
+      SCM xs[5] = {width, height, x, y, argv[4]};
+      add_numbers (out, 5, xs);
+      *out += " draw_round_box\n";
+      return true;
+    }
+  else if (scm_is_eq (head, ly_symbol2scm ("named-glyph")))
+    {
+      // With music-font-encodings, the command depends on the glyph
+      // name; leave that to the backend.
+      if (argc != 2 || music_font_encodings_ || !scm_is_string (argv[1]))
+        return false;
+      *out += font_command (argv[0]);
+      *out += " /";
+      *out += ly_scm2string (argv[1]);
+      *out += " glyphshow\n";
+      return true;
+    }
+  else if (scm_is_eq (head, ly_symbol2scm ("setcolor")))
+    {
+      // Color names are resolved by the backend.
+      if (argc < 3 || !all_numbers (3, argv))
+        return false;
+      *out += "gsave ";
+      add_numbers (out, 3, argv);
+      *out += " setrgbcolor\n";
+      return true;
+    }
+  else if (scm_is_eq (head, ly_symbol2scm ("setrotation")))
+    {
+      // ang x y
+      if (argc != 3 || !all_numbers (argc, argv))
+        return false;
+      SCM minus_one = scm_from_int (-1);
+      SCM back[2] = {scm_product (minus_one, argv[1]),
+                     scm_product (minus_one, argv[2])
+                    };
+      *out += "gsave ";
+      add_numbers (out, 2, argv + 1);
+      *out += " translate ";
+      *out += format_single_argument (argv[0], 8);
+      *out += " rotate ";
+      add_numbers (out, 2, back);
+      *out += " translate\n";
+      return true;
+    }
+  else if (scm_is_eq (head, ly_symbol2scm ("setscale")))
+    {
+      if (argc != 2 || !all_numbers (argc, argv))
+        return false;
+      *out += "gsave ";
+      add_numbers (out, 2, argv);
+      *out += " scale\n";
+      return true;
+    }
+  else if (scm_is_eq (head, ly_symbol2scm ("resetcolor"))
+           || scm_is_eq (head, ly_symbol2scm ("resetrotation"))
+           || scm_is_eq (head, ly_symbol2scm ("resetscale")))
+    {
+      *out += "grestore\n";
+      return true;
+    }
+  else if (scm_is_eq (head, ly_symbol2scm ("no-origin"))
+           || scm_is_eq (head, ly_symbol2scm ("reset-grob-cause")))
+    return true;
+
+  return false;
+}
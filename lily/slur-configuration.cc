@@ -34,12 +34,10 @@
 #include "warn.hh"
 
 #include <cmath>
-#include <memory>
 #include <string>
 #include <vector>
 
 using std::string;
-using std::unique_ptr;
 using std::vector;
 
 Bezier
@@ -558,10 +556,11 @@ Slur_configuration::done () const
   return next_scorer_todo >= NUM_SCORERS;
 }
 
-unique_ptr<Slur_configuration>
-Slur_configuration::new_config (Drul_array<Offset> const &offs, size_t idx)
+Slur_configuration *
+Slur_configuration::new_config (Arena<Slur_configuration> *arena,
+                                Drul_array<Offset> const &offs, size_t idx)
 {
-  unique_ptr<Slur_configuration> conf (new Slur_configuration);
+  Slur_configuration *conf = arena->make ();
   conf->attachment_ = offs;
   conf->index_ = idx;
   conf->next_scorer_todo = INITIAL_SCORE + 1;
@@ -46,13 +46,11 @@
 #include "warn.hh"
 
 #include <cmath>
-#include <memory>
 #include <queue>
 #include <string>
 #include <vector>
 
 using std::string;
-using std::unique_ptr;
 using std::vector;
 
 /*
@@ -76,6 +74,7 @@ using std::vector;
 class Slur_score_state;
 
 Slur_score_state::Slur_score_state ()
+  : configuration_arena_ (64)
 {
   musical_dy_ = 0.0;
   valid_ = false;
@@ -415,7 +414,7 @@ Slur_score_state::get_forced_configuration (Interval ys) const
                + fabs (configurations_[i]->attachment_[RIGHT][Y_AXIS] - ys[RIGHT]);
       if (d < mindist)
         {
-          best = configurations_[i].get ();
+          best = configurations_[i];
           mindist = d;
         }
     }
@@ -435,7 +434,7 @@ Slur_score_state::get_best_curve () const
   std::priority_queue < Slur_configuration *, std::vector<Slur_configuration *>,
       Slur_configuration_less > queue;
   for (vsize i = 0; i < configurations_.size (); i++)
-    queue.push (configurations_[i].get ());
+    queue.push (configurations_[i]);
 
   Slur_configuration *best = NULL;
   while (true)
@@ -711,10 +710,10 @@ Slur_score_state::generate_curves () const
     configurations_[i]->generate_curve (*this, r_0, h_inf, avoid);
 }
 
-vector<unique_ptr<Slur_configuration>>
-                                    Slur_score_state::enumerate_attachments (Drul_array<Real> end_ys) const
+vector<Slur_configuration *>
+Slur_score_state::enumerate_attachments (Drul_array<Real> end_ys)
 {
-  vector<unique_ptr<Slur_configuration>> scores;
+  vector<Slur_configuration *> scores;
 
   Drul_array<Offset> os;
   os[LEFT] = base_attachments_[LEFT];
@@ -783,7 +782,8 @@ vector<unique_ptr<Slur_configuration>>
                 }
             }
 
-          scores.push_back (Slur_configuration::new_config (os, scores.size ()));
+          scores.push_back (Slur_configuration::new_config (&configuration_arena_,
+                                                            os, scores.size ()));
 
           os[RIGHT][Y_AXIS] += dir_ * staff_space_ / 2;
         }
@@ -0,0 +1,177 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "smob-census.hh"
+
+#include "international.hh"
+#include "smobs.hh"
+#include "string-convert.hh"
+#include "system.hh"
+#include "warn.hh"
+
+#include <algorithm>
+
+using std::string;
+using std::vector;
+
+bool smob_census = false;
+
+/* Root systems, as keys of a weak hash table.  */
+static Protected_scm census_systems;
+
+static SCM
+accumulate_system (void *, SCM key, SCM, SCM result)
+{
+  return scm_cons (key, result);
+}
+
+Smob_census::Smob_census ()
+{
+  scm_gc ();
+
+  for (Smob_counter const *c = Smob_counter::list (); c; c = c->next ())
+    if (c->name_ && c->live_)
+      {
+        if (c->parent_)
+          smobs_.push_back ({string (c->parent_) + "/" + c->name_, SUBCLASS,
+                             c->live_, c->bytes_, 0});
+        else
+          smobs_.push_back ({c->name_, SMOB, c->live_, c->bytes_, 0});
+      }
+
+  if (census_systems.is_bound ())
+    {
+      // The list keeps the systems alive while we look at them.
+      SCM systems
+        = scm_internal_hash_fold ((scm_t_hash_fold_fn) &accumulate_system,
+                                  NULL, SCM_EOL, census_systems);
+      for (SCM s = systems; scm_is_pair (s); s = scm_cdr (s))
+        if (System *system = unsmob<System> (scm_car (s)))
+          system->add_to_census (this);
+      scm_remember_upto_here_1 (systems);
+    }
+}
+
+void
+Smob_census::add_grob (string const &name, size_t bytes, vsize alist_entries)
+{
+  Entry &e = grobs_[name];
+  if (!e.count_)
+    {
+      e.name_ = name;
+      e.kind_ = GROB;
+    }
+  e.count_++;
+  e.bytes_ += bytes;
+  e.alist_entries_ += alist_entries;
+}
+
+vector<Smob_census::Entry>
+Smob_census::entries () const
+{
+  vector<Entry> all (smobs_);
+  for (auto const &g : grobs_)
+    all.push_back (g.second);
+  std::stable_sort (all.begin (), all.end (),
+                    [] (Entry const &a, Entry const &b)
+  {
+    return a.bytes_ > b.bytes_;
+  });
+  return all;
+}
+
+/*
+  Grobs and subclasses are counted twice, so the share of an entry is
+  taken of the total of the smob types only.  Entries taking at least
+  a tenth of it are flagged.
+*/
+string
+Smob_census::table (string const &title) const
+{
+  size_t total = 0;
+  for (Entry const &e : smobs_)
+    if (e.kind_ == SMOB)
+      total += e.bytes_;
+
+  string s = title + "\n";
+  s += String_convert::form_string ("  %-32s %10s %12s %6s %8s\n",
+                                    "type", "count", "bytes", "share",
+                                    "alist");
+  for (Entry const &e : entries ())
+    {
+      Real share = total ? 100.0 * Real (e.bytes_) / Real (total) : 0.0;
+      string name = (e.kind_ == GROB ? "grob " : "") + e.name_;
+      string alist = e.kind_ == GROB
+                     ? String_convert::form_string ("%8.1f",
+                                                    Real (e.alist_entries_)
+                                                    / Real (e.count_))
+                     : "";
+      s += String_convert::form_string ("%s %-32s %10zu %12zu %5.1f%% %8s\n",
+                                        share >= 10.0 ? "*" : " ",
+                                        name.c_str (), e.count_, e.bytes_,
+                                        share, alist.c_str ());
+    }
+  s += String_convert::form_string ("  %-32s %10s %12zu\n", "total", "",
+                                    total);
+  return s;
+}
+
+void
+Smob_census::take (char const *phase)
+{
+  Smob_census census;
+  message (census.table (_f ("Smob census after %s:", phase)), false);
+}
+
+void
+Smob_census::add_system (System *s)
+{
+  if (!census_systems.is_bound ())
+    census_systems = scm_make_weak_key_hash_table (to_scm (61));
+  scm_hashq_set_x (census_systems, s->self_scm (), SCM_BOOL_T);
+}
+
+LY_DEFINE (ly_smob_census, "ly:smob-census",
+           0, 0, 0, (),
+           "Collect garbage and return a list of the live smobs and"
+           " grobs, each entry being a list @code{(@var{name} @var{kind}"
+           " @var{count} @var{bytes} @var{alist-entries})}, largest first."
+           "  @var{kind} is @code{smob}, @code{subclass} for a part of"
+           " another smob type like @code{Prob/Music}, or @code{grob} for"
+           " the grobs of one name, which are also counted as @code{Grob}"
+           " smobs.")
+{
+  static char const *const kinds[] = {"smob", "subclass", "grob"};
+
+  Smob_census census;
+  SCM result = SCM_EOL;
+  vector<Smob_census::Entry> entries = census.entries ();
+  for (vsize i = entries.size (); i--;)
+    {
+      Smob_census::Entry const &e = entries[i];
+      result = scm_cons (scm_list_5 (ly_string2scm (e.name_),
+                                     ly_symbol2scm (kinds[e.kind_]),
+                                     scm_from_size_t (e.count_),
+                                     scm_from_size_t (e.bytes_),
+                                     scm_from_size_t (e.alist_entries_)),
+                         result);
+    }
+  return result;
+}
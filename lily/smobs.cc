@@ -104,6 +104,8 @@ unprotect_smob (SCM smob)
 
 Scm_init const *Scm_init::list_ = 0;
 
+Smob_counter *Smob_counter::list_ = 0;
+
 void
 Scm_init::init ()
 {
@@ -223,7 +223,6 @@ Spanner::accepts_as_bound_paper_column (const Paper_column *col) const
 Preinit_Spanner::Preinit_Spanner ()
 {
   spanned_drul_.set (0, 0);
-  pure_property_cache_ = SCM_UNDEFINED;
 }
 
 Spanner::Spanner (SCM s)
@@ -327,8 +326,6 @@ Spanner::is_broken () const
 void
 Spanner::derived_mark () const
 {
-  scm_gc_mark (pure_property_cache_);
-
   for (LEFT_and_RIGHT (d))
     if (spanned_drul_[d])
       scm_gc_mark (spanned_drul_[d]->self_scm ());
@@ -520,37 +517,6 @@ Spanner::kill_zero_spanned_time (SCM grob)
   return SCM_UNSPECIFIED;
 }
 
-// The pure property cache is indexed by (name start . end), where name is
-// a symbol, and start and end are numbers referring to the starting and
-// ending column ranks of the current line.
-static SCM
-make_pure_property_cache_key (SCM sym, vsize start, vsize end)
-{
-  return scm_cons2 (sym, to_scm (start), to_scm (end));
-}
-
-SCM
-Spanner::get_cached_pure_property (SCM sym, vsize start, vsize end)
-{
-  if (SCM_UNBNDP (pure_property_cache_))
-    return SCM_UNDEFINED;
-
-  return scm_hash_ref (pure_property_cache_,
-                       make_pure_property_cache_key (sym, start, end),
-                       SCM_UNDEFINED);
-}
-
-void
-Spanner::cache_pure_property (SCM sym, vsize start, vsize end, SCM val)
-{
-  if (SCM_UNBNDP (pure_property_cache_))
-    pure_property_cache_ = scm_c_make_hash_table (17);
-
-  scm_hash_set_x (pure_property_cache_,
-                  make_pure_property_cache_key (sym, start, end),
-                  val);
-}
-
 ADD_INTERFACE (Spanner,
                "Some objects are horizontally spanned between objects.  For"
                " example, slurs, beams, ties, etc.  These grobs form a subtype"
@@ -29,21 +29,39 @@
 
 /* TODO: Rename Stream_event -> Event */
 
+/* The Prob counter includes all events; count them separately for
+   the census.  */
+static Smob_counter event_counter ("Stream_event", "Prob");
+
 Stream_event::Stream_event ()
   : Prob (ly_symbol2scm ("Stream_event"), SCM_EOL)
 {
+  event_counter.add (sizeof (Stream_event));
+}
+
+Stream_event::Stream_event (Stream_event const &src)
+  : Prob (src)
+{
+  event_counter.add (sizeof (Stream_event));
+}
+
+Stream_event::~Stream_event ()
+{
+  event_counter.remove (sizeof (Stream_event));
 }
 
 Stream_event::Stream_event (SCM event_class, SCM immutable_props)
   : Prob (ly_symbol2scm ("Stream_event"),
           scm_acons (ly_symbol2scm ("class"), event_class, immutable_props))
 {
+  event_counter.add (sizeof (Stream_event));
 }
 
 Stream_event::Stream_event (SCM class_name, Input *origin)
   : Prob (ly_symbol2scm ("Stream_event"),
           scm_list_1 (scm_cons (ly_symbol2scm ("class"), class_name)))
 {
+  event_counter.add (sizeof (Stream_event));
   if (origin)
     set_spot (origin);
 }
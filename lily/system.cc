@@ -33,8 +33,10 @@
 #include "paper-column.hh"
 #include "paper-score.hh"
 #include "paper-system.hh"
+#include "phase-timeline.hh"
 #include "pointer-group-interface.hh"
 #include "skyline-pair.hh"
+#include "smob-census.hh"
 #include "staff-symbol-referencer.hh"
 #include "system-start-delimiter.hh"
 #include "text-interface.hh"
@@ -62,6 +64,7 @@ System::System (SCM s)
   all_elements_ = 0;
   rank_ = 0;
   init_elements ();
+  Smob_census::add_system (this);
 }
 
 void
@@ -79,6 +82,74 @@ System::element_count () const
   return all_elements_->size ();
 }
 
+/*
+  Release the layout data of our grobs and those of the broken
+  systems.  The grobs stay alive as long as stencils refer to them,
+  but no longer keep each other alive through us.  We keep our own
+  properties: the output may still build a system stencil from them,
+  see paper-system-stencil.
+*/
+void
+System::release_layout ()
+{
+  // Extents may depend on grobs in other systems, so compute all of
+  // them before any grob drops its layout data.
+  for (vsize i = 0; i < broken_intos_.size (); i++)
+    if (System *child = dynamic_cast<System *> (broken_intos_[i]))
+      for (vsize j = 0; j < child->all_elements_->size (); j++)
+        child->all_elements_->grob (j)->cache_output_extents ();
+  for (vsize i = 0; i < all_elements_->size (); i++)
+    all_elements_->grob (i)->cache_output_extents ();
+
+  for (vsize i = 0; i < broken_intos_.size (); i++)
+    if (System *child = dynamic_cast<System *> (broken_intos_[i]))
+      child->release_layout ();
+
+  for (vsize i = 0; i < all_elements_->size (); i++)
+    {
+      Grob *g = all_elements_->grob (i);
+      if (g != this)
+        g->release_layout ();
+    }
+  all_elements_->clear ();
+}
+
+/*
+  Pure values are only asked for while breaking lines and pages.
+  Afterwards, their caches would only make every garbage collection
+  walk a hash table per grob.
+*/
+void
+System::clear_pure_caches ()
+{
+  for (vsize i = 0; i < broken_intos_.size (); i++)
+    if (System *child = dynamic_cast<System *> (broken_intos_[i]))
+      child->clear_pure_caches ();
+
+  for (vsize i = 0; i < all_elements_->size (); i++)
+    all_elements_->grob (i)->pure_property_cache_ = SCM_UNDEFINED;
+  pure_property_cache_ = SCM_UNDEFINED;
+}
+
+/* Count our grobs and those of the broken systems.  */
+void
+System::add_to_census (Smob_census *census) const
+{
+  for (vsize i = 0; i < all_elements_->size (); i++)
+    {
+      Grob *g = all_elements_->grob (i);
+      size_t size = dynamic_cast<Spanner *> (g) ? sizeof (Spanner)
+                    : sizeof (Item);
+      vsize entries = scm_ilength (g->mutable_property_alist_)
+                      + scm_ilength (g->object_alist_);
+      census->add_grob (g->name (), size, entries);
+    }
+
+  for (vsize i = 0; i < broken_intos_.size (); i++)
+    if (System *child = dynamic_cast<System *> (broken_intos_[i]))
+      child->add_to_census (census);
+}
+
 static bool
 is_spanner (const Grob *g)
 {
@@ -221,6 +292,7 @@ System::get_broken_system_grobs ()
 SCM
 System::get_paper_systems ()
 {
+  Phase_timeline::Scope phase ("stencils");
   SCM lines = scm_c_make_vector (broken_intos_.size (), SCM_EOL);
   for (vsize i = 0; i < broken_intos_.size (); i++)
     {
@@ -190,6 +190,13 @@ static size_t markup_depth = 0;
 void markup_up_depth (void *) { ++markup_depth; }
 void markup_down_depth (void *) { --markup_depth; }
 
+/* Set while interpreting a markup that has a cache key.  The markups
+   inside it are part of its cache entry, so they are not looked up
+   themselves. */
+static bool in_cached_markup = false;
+
+static void leave_cached_markup (void *) { in_cached_markup = false; }
+
 MAKE_SCHEME_CALLBACK_WITH_OPTARGS (Text_interface, interpret_markup, 3, 0,
                                    "Convert a text markup into a stencil."
                                    "  Takes three arguments, @var{layout}, @var{props}, and @var{markup}.\n"
@@ -219,6 +226,17 @@ Text_interface::interpret_markup (SCM layout_smob, SCM props, SCM markup)
       SCM func = scm_car (markup);
       SCM args = scm_cdr (markup);
 
+      SCM cache_key = SCM_BOOL_F;
+      if (!in_cached_markup
+          && from_scm<bool> (ly_get_option (ly_symbol2scm ("markup-cache"))))
+        cache_key = Lily::markup_cache_key (props, markup);
+      if (scm_is_true (cache_key))
+        {
+          SCM cached = Lily::markup_cache_ref (layout_smob, cache_key);
+          if (unsmob<Stencil> (cached))
+            return cached;
+        }
+
       /* Check for non-terminating markups, e.g. recursive calls with
        * changing arguments */
       SCM opt_depth = ly_get_option (ly_symbol2scm ("max-markup-depth"));
@@ -231,6 +249,12 @@ Text_interface::interpret_markup (SCM layout_smob, SCM props, SCM markup)
       // scm_dynwind_rewind_handler (markup_up_depth, 0, SCM_F_WIND_EXPLICITLY);
       markup_up_depth (0);
       scm_dynwind_unwind_handler (markup_down_depth, 0, SCM_F_WIND_EXPLICITLY);
+      if (scm_is_true (cache_key))
+        {
+          in_cached_markup = true;
+          scm_dynwind_unwind_handler (leave_cached_markup, 0,
+                                      SCM_F_WIND_EXPLICITLY);
+        }
       if (markup_depth > max_depth)
         {
           scm_dynwind_end ();
@@ -243,6 +267,9 @@ Text_interface::interpret_markup (SCM layout_smob, SCM props, SCM markup)
 
       SCM retval = scm_apply_2 (func, layout_smob, props, args);
       scm_dynwind_end ();
+
+      if (scm_is_true (cache_key) && unsmob<Stencil> (retval))
+        Lily::markup_cache_set_x (layout_smob, cache_key, retval);
       return retval;
     }
   else
@@ -82,19 +82,13 @@ Tie_formatting_problem::get_attachment (Real y, Drul_array<int> columns) const
 }
 
 Tie_formatting_problem::Tie_formatting_problem ()
+  : configuration_arena_ (32)
 {
   x_refpoint_ = 0;
   y_refpoint_ = 0;
   use_horizontal_spacing_ = true;
 }
 
-Tie_formatting_problem::~Tie_formatting_problem ()
-{
-  for (Tie_configuration_map::const_iterator i (possibilities_.begin ());
-       i != possibilities_.end (); i++)
-    delete (*i).second;
-}
-
 void
 Tie_formatting_problem::set_column_chord_outline (vector<Item *> bounds,
                                                   Direction dir,
@@ -470,7 +464,7 @@ Tie_configuration *
 Tie_formatting_problem::generate_configuration (int pos, Direction dir,
                                                 Drul_array<int> columns, bool y_tune) const
 {
-  Tie_configuration *conf = new Tie_configuration;
+  Tie_configuration *conf = configuration_arena_.make ();
   conf->position_ = pos;
   conf->dir_ = dir;
 
@@ -0,0 +1,203 @@
+/*
+  This file is part of LilyPond, the GNU music typesetter.
+
+  Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+
+  LilyPond is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  LilyPond is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "trace.hh"
+
+#include "grob.hh"
+#include "international.hh"
+#include "lily-version.hh"
+#include "program-option.hh"
+#include "string-convert.hh"
+#include "translator.hh"
+#include "warn.hh"
+
+#include <cstdio>
+#include <unordered_map>
+
+using std::string;
+using std::vector;
+
+bool trace_events = false;
+
+vector<Trace::Event> Trace::events_;
+vsize Trace::limit_ = 0;
+vsize Trace::next_ = 0;
+vsize Trace::dropped_ = 0;
+
+/* Names of events; 0 is the empty name.  */
+static vector<string> trace_names (1);
+static std::unordered_map<void const *, uint32_t> trace_pointer_ids;
+static std::unordered_map<string, uint32_t> trace_string_ids;
+
+static uint32_t
+intern_pointer (void const *key, char const *name)
+{
+  auto it = trace_pointer_ids.find (key);
+  if (it != trace_pointer_ids.end ())
+    return it->second;
+
+  uint32_t id = static_cast<uint32_t> (trace_names.size ());
+  trace_names.push_back (name);
+  trace_pointer_ids.emplace (key, id);
+  return id;
+}
+
+/* Symbols are interned by address; their name is only converted the
+   first time a symbol is seen.  */
+static uint32_t
+intern_symbol (SCM sym)
+{
+  void const *key = reinterpret_cast<void const *> (SCM_UNPACK (sym));
+  auto it = trace_pointer_ids.find (key);
+  if (it != trace_pointer_ids.end ())
+    return it->second;
+
+  uint32_t id = static_cast<uint32_t> (trace_names.size ());
+  trace_names.push_back (ly_symbol2string (sym));
+  trace_pointer_ids.emplace (key, id);
+  return id;
+}
+
+uint32_t
+Trace::intern (Label const &label)
+{
+  if (label.str_)
+    return intern_pointer (label.str_, label.str_);
+  if (label.translator_)
+    {
+      char const *name = label.translator_->class_name ();
+      return intern_pointer (name, name);
+    }
+  if (scm_is_symbol (label.sym_))
+    return intern_symbol (label.sym_);
+  if (label.grob_)
+    {
+      SCM sym = label.grob_->name_symbol ();
+      if (scm_is_symbol (sym))
+        return intern_symbol (sym);
+      // Grobs without a meta name are rare; interning their class
+      // name by string is good enough.
+      string name = label.grob_->name ();
+      auto it = trace_string_ids.find (name);
+      if (it != trace_string_ids.end ())
+        return it->second;
+      uint32_t id = static_cast<uint32_t> (trace_names.size ());
+      trace_names.push_back (name);
+      trace_string_ids.emplace (name, id);
+      return id;
+    }
+  return 0;
+}
+
+void
+Trace::record (Category category, Label const &name, Label const &detail,
+               Clock::time_point start, Clock::time_point end,
+               bool has_value, Real value)
+{
+  if (!limit_)
+    {
+      SCM limit = ly_get_option (ly_symbol2scm ("trace-event-limit"));
+      limit_ = std::max (1, from_scm (limit, 1 << 18));
+      events_.reserve (std::min (limit_, vsize (1 << 16)));
+    }
+
+  Event e;
+  e.name_ = intern (name);
+  e.detail_ = intern (detail);
+  e.category_ = category;
+  e.has_value_ = has_value;
+  e.value_ = value;
+  e.start_ = start;
+  e.duration_ = end - start;
+
+  if (events_.size () < limit_)
+    events_.push_back (e);
+  else
+    {
+      // Full: overwrite the oldest event.
+      events_[next_] = e;
+      next_ = (next_ + 1) % limit_;
+      dropped_++;
+    }
+}
+
+void
+Trace::write_json (string const &file_name)
+{
+  FILE *out = fopen (file_name.c_str (), "w");
+  if (!out)
+    {
+      warning (_f ("cannot write trace events: %s", file_name.c_str ()));
+      return;
+    }
+
+  static char const *const category_names[] = {"phase", "translation",
+                                                "callback"};
+
+  Clock::time_point origin = Clock::time_point::max ();
+  for (Event const &e : events_)
+    origin = std::min (origin, e.start_);
+
+  fprintf (out, "{\"traceEvents\": [");
+  for (vsize i = 0; i < events_.size (); i++)
+    {
+      // Oldest first.
+      Event const &e = events_[(next_ + i) % events_.size ()];
+      Real start = std::chrono::duration<Real, std::micro> (e.start_ - origin)
+                   .count ();
+      Real duration = std::chrono::duration<Real, std::micro> (e.duration_)
+                      .count ();
+
+      fprintf (out, "%s\n{\"name\": %s, \"cat\": \"%s\", \"ph\": \"X\","
+               " \"pid\": 1, \"tid\": 1, \"ts\": %.3f, \"dur\": %.3f",
+               i ? "," : "",
+               String_convert::json_quote (trace_names[e.name_]).c_str (),
+               category_names[e.category_], start, duration);
+      if (e.detail_ || e.has_value_)
+        {
+          fprintf (out, ", \"args\": {");
+          if (e.detail_)
+            fprintf (out, "\"detail\": %s",
+                     String_convert::json_quote (trace_names[e.detail_])
+                     .c_str ());
+          if (e.has_value_)
+            fprintf (out, "%s\"value\": %g", e.detail_ ? ", " : "",
+                     e.value_);
+          fprintf (out, "}");
+        }
+      fprintf (out, "}");
+    }
+  fprintf (out, "\n],\n\"otherData\": {\"version\": %s,"
+           " \"dropped-events\": %zu}}\n",
+           String_convert::json_quote (version_string ()).c_str (),
+           dropped_);
+
+  if (fclose (out) != 0)
+    warning (_f ("cannot write trace events: %s", file_name.c_str ()));
+}
+
+LY_DEFINE (ly_write_trace_events, "ly:write-trace-events",
+           1, 0, 0, (SCM file_name),
+           "Write the events recorded with @code{-dtrace-events} to"
+           " @var{file-name} in the Chrome trace event format.")
+{
+  LY_ASSERT_TYPE (scm_is_string, file_name, 1);
+  Trace::write_json (ly_scm2string (file_name));
+  return SCM_UNSPECIFIED;
+}
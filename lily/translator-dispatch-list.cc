@@ -19,6 +19,7 @@
 
 #include "translator-dispatch-list.hh"
 #include "engraver.hh"
+#include "trace.hh"
 
 void
 Engraver_dispatch_list::apply (Grob_info gi)
@@ -31,6 +32,8 @@ Engraver_dispatch_list::apply (Grob_info gi)
       if (scm_is_eq (e.instance (), origin))
         continue;
 
+      Trace::Scope trace (Trace::TRANSLATION,
+                          unsmob<Translator> (e.instance ()), "acknowledge");
       e (grob, origin);
     }
 }
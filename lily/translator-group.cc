@@ -35,6 +35,7 @@
 #include "performer-group.hh"
 #include "scheme-engraver.hh"
 #include "scm-hash.hh"
+#include "trace.hh"
 #include "warn.hh"
 
 using std::vector;
@@ -99,13 +100,20 @@ Translator_group::finalize ()
   translators; all incoming events are instead protected by the
   translator group.
 
+  An event is handed to all translators of the group that listen to
+  it in a row, so it only needs to be added once.  The list lives as
+  long as the context and is marked in every collection, so keeping
+  it short saves both the pairs and the marking.
+
   TODO: Should the list also be flushed at the beginning of each new
   moment?
  */
 void
 Translator_group::protect_event (SCM ev)
 {
-  protected_events_ = scm_cons (ev, protected_events_);
+  if (!scm_is_pair (protected_events_)
+      || !scm_is_eq (scm_car (protected_events_), ev))
+    protected_events_ = scm_cons (ev, protected_events_);
 }
 
 /*
@@ -261,6 +269,25 @@ void
 Translator_group::precomputed_translator_foreach (Translator_precompute_index idx)
 {
   vector<Method_instance> &bindings (precomputed_method_bindings_[idx]);
+  if (trace_events)
+    {
+      static char const *const method_names[] =
+      {
+        "start_translation_timestep",
+        "stop_translation_timestep",
+        "process_music",
+        "process_acknowledged",
+      };
+      for (vsize i = 0; i < bindings.size (); i++)
+        {
+          Trace::Scope trace (Trace::TRANSLATION,
+                              unsmob<Translator> (bindings[i].instance ()),
+                              method_names[idx]);
+          bindings[i] ();
+        }
+      return;
+    }
+
   for (vsize i = 0; i < bindings.size (); i++)
     bindings[i] ();
 }
@@ -135,6 +135,7 @@
           (delete-file flush-name)))
 
     (ly:rename-file pdf-name dest)
+    (ly:note-output-file dest)
     ))
 
 (define-public (postscript->png resolution paper-width paper-height
@@ -161,7 +162,8 @@
     (if (not (equal? ps-name tmp-name))
         (begin
           (ly:message (_ "Copying to `~a'...\n") ps-name)
-          (copy-binary-file tmp-name ps-name)))))
+          (copy-binary-file tmp-name ps-name)
+          (ly:note-output-file ps-name)))))
 
 (define-public (mkdir-if-not-exist path . mode)
   (catch
@@ -327,7 +329,8 @@
       (display value)
       (let ((port (open-file file-name "w")))
         (display value port)
-        (close-port port)))
+        (close-port port)
+        (ly:note-output-file file-name)))
 
   (ly:progress "\n")
   "")
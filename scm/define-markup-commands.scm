@@ -124,6 +124,7 @@
   (define-markup-command (line layout props args)
     (markup-list?)
     #:category align
+    #:cacheable #t
     #:properties ((word-space)
                   (text-direction RIGHT))
     "Put @var{args} in a horizontal line.  The property @code{word-space}
@@ -462,6 +463,7 @@ A triangle, either filled or empty.
 (define-markup-command (circle layout props arg)
   (markup?)
   #:category graphic
+  #:cacheable #t
   #:properties ((thickness 1)
                 (font-size 0)
                 (circle-padding 0.2))
@@ -827,6 +829,7 @@ Overtie @var{arg}.
 (define-markup-command (box layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   #:properties ((thickness 1)
                 (font-size 0)
                 (box-padding 0.2))
@@ -1017,6 +1020,7 @@ Create a box of the same height as the space in the current font."
 (define-markup-command (hspace layout props amount)
   (number?)
   #:category align
+  #:cacheable #t
   "
 @cindex creating horizontal space, in text
 
@@ -1036,6 +1040,7 @@ Create an invisible object taking up horizontal space @var{amount}.
 (define-markup-command (vspace layout props amount)
   (number?)
   #:category align
+  #:cacheable #t
   "
 @cindex creating vertical space, in text
 
@@ -1385,6 +1390,7 @@ An empty markup with extents of a single point.
 (define-markup-command (simple layout props str)
   (string?)
   #:category font
+  #:cacheable #t
   "
 @cindex simple text string
 
@@ -1604,6 +1610,7 @@ space.  If there are no arguments, return an empty stencil.
 (define-markup-command (concat layout props args)
   (markup-list?)
   #:category align
+  #:cacheable #t
   "
 @cindex concatenating text
 @cindex ligature, in text
@@ -2139,6 +2146,7 @@ Align @code{arg} to its Y@tie{}center.
 (define-markup-command (center-align layout props arg)
   (markup?)
   #:category align
+  #:cacheable #t
   "
 @cindex horizontally centering text
 
@@ -2160,6 +2168,7 @@ Align @code{arg} to its X@tie{}center.
 (define-markup-command (right-align layout props arg)
   (markup?)
   #:category align
+  #:cacheable #t
   "
 @cindex right-aligning text
 
@@ -2181,6 +2190,7 @@ Align @var{arg} on its right edge.
 (define-markup-command (left-align layout props arg)
   (markup?)
   #:category align
+  #:cacheable #t
   "
 @cindex left-aligning text
 
@@ -2202,6 +2212,7 @@ Align @var{arg} on its left edge.
 (define-markup-command (general-align layout props axis dir arg)
   (integer? number? markup?)
   #:category align
+  #:cacheable #t
   "
 @cindex controlling general text alignment
 
@@ -2242,6 +2253,7 @@ Align @var{arg} in @var{axis} direction to the @var{dir} side.
 (define-markup-command (halign layout props dir arg)
   (number? markup?)
   #:category align
+  #:cacheable #t
   "
 @cindex setting horizontal text alignment
 
@@ -2405,6 +2417,7 @@ Add padding @var{amount} around @var{arg} in the X@tie{}direction.
 (define-markup-command (hcenter-in layout props length arg)
   (number? markup?)
   #:category align
+  #:cacheable #t
   "Center @var{arg} horizontally within a box of extending
 @var{length}/2 to the left and right.
 
@@ -2626,6 +2639,7 @@ of its own.
 (define-markup-command (smaller layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Decrease the font size relative to the current setting.
 
 @lilypond[verbatim,quote]
@@ -2647,6 +2661,7 @@ of its own.
 (define-markup-command (larger layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Increase the font size relative to the current setting.
 
 @lilypond[verbatim,quote]
@@ -2663,6 +2678,7 @@ of its own.
 (define-markup-command (finger layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set @var{arg} as small numbers.
 
 @lilypond[verbatim,quote]
@@ -2680,6 +2696,7 @@ of its own.
   (number? markup?)
   #:properties ((word-space 0.6) (baseline-skip 3))
   #:category font
+  #:cacheable #t
   "Use @var{size} as the absolute font size (in points) to display @var{arg}.
 Adjusts @code{baseline-skip} and @code{word-space} accordingly.
 
@@ -2707,6 +2724,7 @@ Adjusts @code{baseline-skip} and @code{word-space} accordingly.
 (define-markup-command (fontsize layout props increment arg)
   (number? markup?)
   #:category font
+  #:cacheable #t
   #:properties ((font-size 0)
                 (word-space 1)
                 (baseline-skip 2))
@@ -2733,6 +2751,7 @@ accordingly.
 (define-markup-command (magnify layout props sz arg)
   (number? markup?)
   #:category font
+  #:cacheable #t
   "
 @cindex magnifying text
 
@@ -2763,6 +2782,7 @@ Use @code{\\fontsize} otherwise.
 (define-markup-command (bold layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Switch to bold font-series.
 
 @lilypond[verbatim,quote]
@@ -2778,6 +2798,7 @@ Use @code{\\fontsize} otherwise.
 (define-markup-command (sans layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Switch to the sans serif font family.
 
 @lilypond[verbatim,quote]
@@ -2794,6 +2815,7 @@ Use @code{\\fontsize} otherwise.
 (define-markup-command (number layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set font family to @code{number}, which yields the font used for
 time signatures and fingerings.  This font contains numbers and
 some punctuation; it has no letters.
@@ -2810,6 +2832,7 @@ some punctuation; it has no letters.
 (define-markup-command (roman layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set font family to @code{roman}.
 
 @lilypond[verbatim,quote]
@@ -2830,6 +2853,7 @@ some punctuation; it has no letters.
 (define-markup-command (huge layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set font size to +2.
 
 @lilypond[verbatim,quote]
@@ -2845,6 +2869,7 @@ some punctuation; it has no letters.
 (define-markup-command (large layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set font size to +1.
 
 @lilypond[verbatim,quote]
@@ -2860,6 +2885,7 @@ some punctuation; it has no letters.
 (define-markup-command (normalsize layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set font size to default.
 
 @lilypond[verbatim,quote]
@@ -2880,6 +2906,7 @@ some punctuation; it has no letters.
 (define-markup-command (small layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set font size to -1.
 
 @lilypond[verbatim,quote]
@@ -2895,6 +2922,7 @@ some punctuation; it has no letters.
 (define-markup-command (tiny layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set font size to -2.
 
 @lilypond[verbatim,quote]
@@ -2910,6 +2938,7 @@ some punctuation; it has no letters.
 (define-markup-command (teeny layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set font size to -3.
 
 @lilypond[verbatim,quote]
@@ -2935,6 +2964,7 @@ fonts which support the @code{caps} font shape."
 (define-markup-command (smallCaps layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Emit @var{arg} as small caps.
 
 Note: @code{\\smallCaps} does not support accented characters.
@@ -2982,6 +3012,7 @@ Note: @code{\\smallCaps} does not support accented characters.
 (define-markup-command (caps layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Copy of the @code{\\smallCaps} command.
 
 @lilypond[verbatim,quote]
@@ -2998,6 +3029,7 @@ Note: @code{\\smallCaps} does not support accented characters.
 (define-markup-command (dynamic layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Use the dynamic font.  This font only contains @b{s}, @b{f}, @b{m},
 @b{z}, @b{p}, and @b{r}.  When producing phrases, like
 @q{pi@`{u}@tie{}@b{f}}, the normal words (like @q{pi@`{u}}) should be
@@ -3015,6 +3047,7 @@ done in a different font.  The recommended font for this is bold and italic.
 (define-markup-command (text layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Use a text font instead of music symbol or music alphabet font.
 
 @lilypond[verbatim,quote]
@@ -3036,6 +3069,7 @@ done in a different font.  The recommended font for this is bold and italic.
 (define-markup-command (italic layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Use italic @code{font-shape} for @var{arg}.
 
 @lilypond[verbatim,quote]
@@ -3051,6 +3085,7 @@ done in a different font.  The recommended font for this is bold and italic.
 (define-markup-command (typewriter layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Use @code{font-family} typewriter for @var{arg}.
 
 @lilypond[verbatim,quote]
@@ -3067,6 +3102,7 @@ done in a different font.  The recommended font for this is bold and italic.
 (define-markup-command (upright layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set @code{font-shape} to @code{upright}.  This is the opposite
 of @code{italic}.
 
@@ -3089,6 +3125,7 @@ of @code{italic}.
 (define-markup-command (medium layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Switch to medium font-series (in contrast to bold).
 
 @lilypond[verbatim,quote]
@@ -3110,6 +3147,7 @@ of @code{italic}.
 (define-markup-command (normal-text layout props arg)
   (markup?)
   #:category font
+  #:cacheable #t
   "Set all font related properties (except the size) to get the default
 normal text font, no matter what font was used earlier.
 
@@ -3140,6 +3178,7 @@ normal text font, no matter what font was used earlier.
 (define-markup-command (musicglyph layout props glyph-name)
   (string?)
   #:category music
+  #:cacheable #t
   "@var{glyph-name} is converted to a musical symbol; for example,
 @code{\\musicglyph #\"accidentals.natural\"} selects the natural sign from
 the music font.  See @ruser{The Emmentaler font} for a complete listing of
@@ -3421,6 +3460,7 @@ Use the filled head if @var{filled} is specified.
 (define-markup-command (char layout props num)
   (integer?)
   #:category other
+  #:cacheable #t
   "Produce a single character.  Characters encoded in hexadecimal
 format require the prefix @code{#x}.
 
@@ -4251,6 +4291,7 @@ an inverted glyph.  Note that within music, one would usually use the
 (define-markup-command (lower layout props amount arg)
   (number? markup?)
   #:category align
+  #:cacheable #t
   "
 @cindex lowering text
 
@@ -4297,6 +4338,7 @@ Translate @var{arg} by @var{offset}, scaling the offset by the
 (define-markup-command (raise layout props amount arg)
   (number? markup?)
   #:category align
+  #:cacheable #t
   "
 @cindex raising text
 
@@ -4411,6 +4453,7 @@ Set @var{arg} in superscript.
 (define-markup-command (translate layout props offset arg)
   (number-pair? markup?)
   #:category align
+  #:cacheable #t
   "
 @cindex translating text
 
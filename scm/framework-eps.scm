@@ -110,7 +110,8 @@ alignment."
                                       (port (make-tmpfile name)))
                                  (ly:message (_ "Writing ~a...") name)
                                  (display (get-output-string str-port) port)
-                                 (close-port-rename port name)))))
+                                 (close-port-rename port name)
+                                 (ly:note-output-file name)))))
              (tex-system-port (open-output-string))
              (texi-system-port (open-output-string))
              (count-system-port (open-output-string)))
@@ -49,6 +49,12 @@
         "%" "_" name)))
      "m" (string-encode-integer (inexact->exact (round (* 1000 magnify)))))))
 
+(define (make-ps-outputter port)
+  (let ((outputter (ly:make-paper-outputter port stencil-dispatch-alist)))
+    (if (ly:get-option 'native-ps-output)
+        (ly:outputter-use-native-ps outputter ps-font-command))
+    outputter))
+
 (define (ps-define-pango-pf pango-pf font-name scaling)
   "")
 
@@ -201,6 +207,45 @@
 
 (define never-embed-font-list (list))
 
+;; Fonts converted for embedding, kept for the rest of the run.
+(define converted-font-table (make-hash-table 31))
+
+(define (cached-font-conversion kind file-name font-index convert)
+  "Return the string produced by the thunk @var{convert}, which converts
+font @var{file-name} to @var{kind}.  Results are reused within a run
+and, with @code{-dfont-embed-cache}, across runs.  They are keyed on
+the font's file name, index, size and modification time, and on the
+LilyPond version, since the conversion may change between versions."
+  (let ((st (false-if-exception (stat file-name)))
+        (index (if (number? font-index) font-index 0)))
+    (if (not st)
+        (convert)
+        (let* ((version (lilypond-version))
+               (key (list kind file-name index
+                          (stat:size st) (stat:mtime st) version))
+               (dir (ly:get-option 'font-embed-cache))
+               (cache-file
+                (and (string-or-symbol? dir)
+                     (format #f "~a/~a-~a-~a-~a-~a-~a.~a"
+                             dir (basename file-name) index
+                             (stat:size st) (stat:mtime st)
+                             (string-hash file-name) version kind))))
+          (or (hash-ref converted-font-table key)
+              (let ((data
+                     (if (and cache-file (file-exists? cache-file))
+                         (begin
+                           (ly:debug (_ "Reading converted font `~a'")
+                                     cache-file)
+                           (ly:gulp-file cache-file))
+                         (let ((converted (convert)))
+                           (if cache-file
+                               (let ((port (make-tmpfile cache-file)))
+                                 (display converted port)
+                                 (close-port-rename port cache-file)))
+                           converted))))
+                (hash-set! converted-font-table key data)
+                data))))))
+
 (define (cff-font? font)
   (let* ((cff-string (ly:otf-font-table-data font "CFF ")))
     (> (string-length cff-string) 0)))
@@ -257,7 +302,10 @@
                   (ly:debug (_ "Embedding CFF font `~a'.") name)
                   (set! font-list
                         (acons name-symbol args-filename-offset font-list))
-                  (ps-embed-cff (ly:otf->cff file-name font-index) name 0))))
+                  (ps-embed-cff (cached-font-conversion
+                                 'cff file-name font-index
+                                 (lambda () (ly:otf->cff file-name font-index)))
+                                name 0))))
           (begin
             (ly:debug (_ "Initializing embedded CFF font list."))
             (set! font-list '()))))))
@@ -448,10 +496,14 @@
         ;; Type 1 (PFA and PFB) fonts
         (begin (set! never-embed-font-list
                      (append never-embed-font-list (list name)))
-               (ly:type1->pfa file-name)))
+               (cached-font-conversion
+                'pfa file-name font-index
+                (lambda () (ly:type1->pfa file-name)))))
        ((eq? font-format 'TrueType)
         ;; TrueType fonts (TTF) and TrueType Collection (TTC)
-        (ly:ttf->pfa file-name font-index))
+        (cached-font-conversion
+         't42 file-name font-index
+         (lambda () (ly:ttf->pfa file-name font-index))))
        ((eq? font-format 'CFF)
         ;; OpenType/CFF fonts (OTF) and OpenType/CFF Collection (OTC)
         (check-conflict-and-embed-cff name file-name font-index))
@@ -475,14 +527,16 @@
             (cond ((mac-font? bare-file-name)
                    (handle-mac-font name bare-file-name))
                   ((and font (cff-font? font))
-                   (begin
+                   (let ((otf-file (ly:find-file
+                                    (format #f "~a.otf" file-name)))
+                         (cff (lambda ()
+                                (ly:otf-font-table-data font "CFF "))))
                      (if (ly:get-option 'font-ps-resdir)
-                         (link-ps-resdir-font
-                          name
-                          (ly:find-file
-                           (format #f "~a.otf" file-name))
-                          font-index))
-                     (ps-embed-cff (ly:otf-font-table-data font "CFF ")
+                         (link-ps-resdir-font name otf-file font-index))
+                     (ps-embed-cff (if otf-file
+                                       (cached-font-conversion
+                                        'cff otf-file font-index cff)
+                                       (cff))
                                    name
                                    0)))
                   (bare-file-name (font-file-as-ps-string
@@ -738,7 +792,7 @@ mark {ly~a_stream} /CLOSE pdfmark
 (define-public (output-framework basename book scopes fields)
   (let* ((port (make-tmpfile basename))
          (tmp-name (port-filename port))
-         (outputter (ly:make-paper-outputter port stencil-dispatch-alist))
+         (outputter (make-ps-outputter port))
          (paper (ly:paper-book-paper book))
          (header (ly:paper-book-header book))
          (systems (ly:paper-book-systems book))
@@ -829,7 +883,7 @@ mark {ly~a_stream} /CLOSE pdfmark
          (ignore (ly:message (_  "Layout output to `~a'...") dest-name))
          (port (make-tmpfile dest-name))
          (tmp-name (port-filename port))
-         (outputter (ly:make-paper-outputter port stencil-dispatch-alist))
+         (outputter (make-ps-outputter port))
          (port (ly:outputter-port outputter))
          (rounded-bbox (to-rounded-bp-box bbox))
          (port (ly:outputter-port outputter))
@@ -843,6 +897,7 @@ mark {ly~a_stream} /CLOSE pdfmark
     (display "stroke grestore\n%%Trailer\n%%EOF\n" port)
     (ly:outputter-close outputter)
     (ly:rename-file tmp-name dest-name)
+    (ly:note-output-file dest-name)
     ))
 
 (define (clip-systems-to-region basename paper systems region do-pdf do-png)
@@ -33,7 +33,9 @@
 (define format ergonomic-simple-format)
 
 (define-public (output-framework basename book scopes fields)
-  (let* ((file (open-output-file (format #f "~a.scm" basename))))
+  (let* ((file-name (format #f "~a.scm" basename))
+         (file (open-output-file file-name)))
+    (ly:note-output-file file-name)
 
     (display ";;Creator: LilyPond\n" file)
     (display ";; raw SCM output\n" file)
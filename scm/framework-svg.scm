@@ -145,6 +145,7 @@ src: url('~a');
     (dump (comment (format #f "Page: ~S/~S" page-number page-count)))
     (eval-svg `(set-unit-length ,unit-length))
     (ly:outputter-dump-stencil outputter page)
+    (dump (glyph-defs-end))
     (dump (svg-end))
     (ly:outputter-close outputter)))
 
@@ -180,6 +181,7 @@ src: url('~a');
     (dump (style-defs-end))
     (eval-svg `(set-unit-length ,unit-length))
     (ly:outputter-dump-stencil outputter stencil)
+    (dump (glyph-defs-end))
     (dump (svg-end))
     (ly:outputter-close outputter)))
 
@@ -209,6 +211,7 @@ src: url('~a');
         (dump (woff-header paper (dirname filename))))
     (eval-svg `(set-unit-length ,unit-length))
     (ly:outputter-dump-stencil outputter stencil)
+    (dump (glyph-defs-end))
     (dump (svg-end))
     (ly:outputter-close outputter)))
 
@@ -284,15 +284,25 @@ document.")
     (eps-box-padding #f
      "Pad left edge of the output EPS bounding box by
 given amount (in mm).")
+    (font-embed-cache #f
+     "Directory for keeping fonts converted for
+embedding into PostScript, so later runs can reuse them.")
     (font-export-dir #f
      "Directory for exporting fonts as PostScript
 files.")
+    (font-metric-cache #f
+     "If set to a directory, keep the glyph names,
+character maps and glyph boxes of fonts in files there, so later runs
+need not compute them again.")
     (font-ps-resdir #f
      "Build a subset of PostScript resource directory
 for embedding fonts.")
     (gs-api #t
      "Whether to use the Ghostscript API (read-only
 if not available).")
+    (gs-jobs 1
+     "Number of Ghostscript processes that convert
+the pages of a document to images in parallel.")
     (gs-load-fonts #f
      "Load fonts via Ghostscript.")
     (gs-load-lily-fonts #f
@@ -320,6 +330,9 @@ jobs.")
     (log-file #f
      "If string FOO is given as an argument, redirect
 output to log file `FOO.log'.")
+    (markup-cache #f
+     "Reuse the stencils of identical markups built
+from commands declared @code{#:cacheable}.")
     (max-markup-depth 1024
      "Maximum depth for the markup tree.  If a markup
 has more levels, assume it will not terminate
@@ -336,11 +349,24 @@ operator with music fonts.")
     (music-strings-to-paths #f
      "Convert text strings to paths when glyphs
 belong to a music font.")
+    (native-ps-output #f
+     "Write the most common stencil commands of the
+PostScript backend directly from C++.")
     (outline-bookmarks #t
      "Use bookmarks in table of contents metadata
 (e.g., for PDF viewers).")
+    (output-cache #f
+     "If set to a directory name, keep the output files
+there, and reuse them instead of processing an input file again when
+neither the files it includes nor the options and LilyPond version
+have changed.")
     (paper-size "a4"
      "Set default paper size.")
+    (phase-timeline #f
+     "If set to a file name, write the wall clock
+time, CPU time, memory use and grob count of each processing phase
+there in JSON format on exit, along with the timing totals of all
+named scopes.")
     (pixmap-format "png16m"
      "Set GhostScript's output format for pixel
 images.")
@@ -363,6 +389,10 @@ input files to be processed.")
      "When processing an \\include command, look for
 the included file relative to the current file\
 \n(instead of the root file).")
+    (release-layout #f
+     "Drop the layout data of the grobs of each
+bookpart once its pages are made, so memory use does not grow with
+the number of bookparts.  Ignored with -dclip-systems.")
     (resolution 101
      "Set resolution for generating PNG pixmaps to
 given value (in dpi).")
@@ -374,6 +404,13 @@ output log data to files `FILE1.log',
 `FILE2.log', ...")
     (show-available-fonts #f
      "List available font names.")
+    (smob-census #f
+     "After each processing phase, print how many
+smobs and grobs of each type are alive and roughly how much memory
+they use.")
+    (stencil-display-list #f
+     "Flatten page stencils into a list of output
+commands before passing them to the backend.")
     (strict-infinity-checking #f
      "Force a crash on encountering Inf and NaN
 floating point exceptions.")
@@ -388,6 +425,13 @@ increases but often markedly better PDF
 previews.")
     (svg-woff #f
      "Use woff font files in SVG backend.")
+    (trace-event-limit 262144
+     "The number of most recent events kept for
+-dtrace-events.")
+    (trace-events #f
+     "If set to a file name, record time steps,
+translator calls, grob callbacks and processing phases, and write them
+there in the Chrome trace event format on exit.")
     (verbose ,(ly:verbose-output?)
              "Verbose output, i.e., loglevel at least DEBUG
 (read-only).")
@@ -879,6 +923,12 @@ PIDs or the number of the process."
   "Exit function for lilypond"
   (if (ly:get-option 'gs-api)
       (ly:shutdown-gs))
+  (if (string-or-symbol? (ly:get-option 'phase-timeline))
+      (ly:write-phase-timeline
+       (format #f "~a" (ly:get-option 'phase-timeline))))
+  (if (string-or-symbol? (ly:get-option 'trace-events))
+      (ly:write-trace-events
+       (format #f "~a" (ly:get-option 'trace-events))))
   (if (not silently)
       (case status
         ((0) (ly:basic-progress (_ "Success: compilation successfully completed")))
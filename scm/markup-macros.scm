@@ -51,6 +51,8 @@ The command is now available in markup mode, e.g.
 (define-public markup-function-category (make-object-property))
 ;; markup function -> used properties
 (define-public markup-function-properties (make-object-property))
+;; markup function -> #t if its stencil may be reused, see markup.scm
+(define-public markup-function-cacheable? (make-object-property))
 
 (use-modules (ice-9 optargs))
 
@@ -90,6 +92,12 @@ where:
   `category' is either a symbol or a symbol list specifying the
              categories for this markup command in the docs.
 
+Specifying
+                                 [ #:cacheable #t ]
+declares that the result only depends on `layout', the arguments, the
+font properties and `properties', so interpreting the same markup with
+the same values of these again may reuse the stencil.
+
 As an element of the `properties' list, you may directly use a
 COMMANDx-markup symbol instead of a `(prop value)' list to indicate
 that this markup command is called by the newly defined command,
@@ -116,7 +124,7 @@ command.  There is no protection against circular definitions.
 
 (defmacro*-public markup-lambda
   (args signature
-        #:key (category '()) (properties '())
+        #:key (category '()) (properties '()) (cacheable #f)
         #:rest body)
   "Defines and returns an anonymous markup command.  Other than
 not registering the markup command, this is identical to
@@ -140,19 +148,27 @@ not registering the markup command, this is identical to
                                 (props (cadr args)))
                             `(,prop (chain-assoc-get ',prop ,props ,default-value))))
                         (filter pair? properties))
-               ,@real-body))))
-    `(markup-lambda-worker
-      ,result
-      (list ,@signature)
-      (list ,@(map (lambda (prop-spec)
-                     (cond ((symbol? prop-spec)
-                            prop-spec)
-                           ((not (null? (cdr prop-spec)))
-                            `(list ',(car prop-spec) ,(cadr prop-spec)))
-                           (else
-                            `(list ',(car prop-spec)))))
-                   properties))
-      ',category)))
+               ,@real-body)))
+         (worker
+          `(markup-lambda-worker
+            ,result
+            (list ,@signature)
+            (list ,@(map (lambda (prop-spec)
+                           (cond ((symbol? prop-spec)
+                                  prop-spec)
+                                 ((not (null? (cdr prop-spec)))
+                                  `(list ',(car prop-spec) ,(cadr prop-spec)))
+                                 (else
+                                  `(list ',(car prop-spec)))))
+                         properties))
+            ',category)))
+    (if cacheable
+        `(markup-lambda-cacheable ,worker)
+        worker)))
+
+(define-public (markup-lambda-cacheable command)
+  (set! (markup-function-cacheable? command) #t)
+  command)
 
 (defmacro-public define-markup-list-command
   (command-and-args . definition)
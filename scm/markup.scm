@@ -56,6 +56,97 @@ Example:
    '()
    markup-list))
 
+;;;; reusing stencils of identical markups
+;;
+;; A markup whose commands are all declared #:cacheable is looked up
+;; in a per-layout table, keyed on the markup and the values of the
+;; properties its commands and strings may read.
+
+(define markup-cache-font-properties
+  '(font-encoding font-family font-features font-name font-series
+    font-shape font-size replacement-alist))
+
+(define markup-cache-size 4096)
+
+;; layout -> (entry-count . hash table)
+(define markup-caches (make-weak-key-hash-table 7))
+
+(define (markup-command-properties command)
+  "The properties declared by @var{command}, including those of the
+markup commands it calls."
+  (append-map (lambda (spec)
+                (cond ((pair? spec) (list (car spec)))
+                      ((procedure? spec) (markup-command-properties spec))
+                      (else '())))
+              (or (markup-function-properties command) '())))
+
+(define markup-cache-properties-table (make-weak-key-hash-table 257))
+
+(define (markup-cache-properties m)
+  "The properties that interpreting markup @var{m} may read, or
+@code{#f} if @var{m} uses a command that is not cacheable."
+  (if (string? m)
+      '()
+      (let ((handle (hashq-get-handle markup-cache-properties-table m)))
+        (if handle
+            (cdr handle)
+            (let ((props (compute-markup-cache-properties m)))
+              (hashq-set! markup-cache-properties-table m props)
+              props)))))
+
+(define (compute-markup-cache-properties m)
+  (cond ((string? m) '())
+        ((and (pair? m)
+              (markup-function-cacheable? (car m))
+              (markup-command-signature (car m)))
+         => (lambda (signature)
+              (let loop ((preds signature)
+                         (args (cdr m))
+                         (props (markup-command-properties (car m))))
+                (cond ((or (null? preds) (null? args))
+                       props)
+                      ((eq? (car preds) markup?)
+                       (let ((p (markup-cache-properties (car args))))
+                         (and p (loop (cdr preds) (cdr args)
+                                      (append p props)))))
+                      ((eq? (car preds) markup-list?)
+                       (let ((ps (map markup-cache-properties (car args))))
+                         (and (every identity ps)
+                              (loop (cdr preds) (cdr args)
+                                    (apply append props ps)))))
+                      (else
+                       (loop (cdr preds) (cdr args) props))))))
+        (else #f)))
+
+(define (chain-assq key chain)
+  (and (pair? chain)
+       (or (assq key (car chain))
+           (chain-assq key (cdr chain)))))
+
+(define-public (markup-cache-key props m)
+  "Return a key for reusing the stencil of markup @var{m} interpreted
+with @var{props}, or @code{#f} if it may not be reused."
+  (let ((used (markup-cache-properties m)))
+    (and used
+         (cons m
+               (map (lambda (prop) (chain-assq prop props))
+                    (delete-duplicates
+                     (append markup-cache-font-properties used)
+                     eq?))))))
+
+(define-public (markup-cache-ref layout key)
+  (let ((cache (hashq-ref markup-caches layout)))
+    (and cache (hash-ref (cdr cache) key))))
+
+(define-public (markup-cache-set! layout key stencil)
+  (let ((cache (hashq-ref markup-caches layout)))
+    (if (or (not cache) (>= (car cache) markup-cache-size))
+        (begin
+          (set! cache (cons 0 (make-hash-table 257)))
+          (hashq-set! markup-caches layout cache)))
+    (set-car! cache (1+ (car cache)))
+    (hash-set! (cdr cache) key stencil)))
+
 (define-public (prepend-alist-chain key val chain)
   (cons (acons key val (car chain)) (cdr chain)))
 
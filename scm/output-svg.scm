@@ -149,10 +149,11 @@
 
     (apply entity 'text expr #t (reverse! alist))))
 
-(define (dump-path path scale . rest)
+(define (dump-glyph-use id scale . rest)
   (define alist '())
   (define (set-attribute attr val)
     (set! alist (assoc-set! alist attr val)))
+  (set-attribute 'xlink:href (string-append "#" id))
   (if (not (null? rest))
       (let* ((dx (car rest))
              (dy (cadr rest))
@@ -171,9 +172,8 @@
       (set-attribute 'transform (string-append
                                  "scale(" scale ", -" scale ")")))
 
-  (set-attribute 'd path)
   (set-attribute 'fill "currentColor")
-  (apply entity 'path "" #t (reverse alist)))
+  (apply entity 'use "" #t (reverse alist)))
 
 
 ;; A global variable for keeping track of the *cumulative*
@@ -181,93 +181,121 @@
 ;; is more than one glyph.
 (define next-horiz-adv 0.0)
 
+;; Matches one <glyph> element.  For example:
+;;
+;; <glyph glyph-name="period" unicode="." horiz-adv-x="110"
+;; d="M0 55c0 30 25 55 55 55s55 -25 55
+;; -55s-25 -55 -55 -55s-55 25 -55 55z" />
+(define glyph-element-regexp
+  (make-regexp "<glyph([^>]*)/>"))
+
+;; Matches the glyph-name attribute of a <glyph> element
+(define glyph-name-regexp
+  (make-regexp "[[:space:]]glyph-name=\"([^\"]*)\""))
+
 ;; Matches the required "unicode" attribute from <glyph>
 (define glyph-unicode-value-regexp
   (make-regexp "unicode=\"([^\"]+)\""))
 
 ;; Matches the optional path data from <glyph>
 (define glyph-path-regexp
-  (make-regexp "d=\"([-+MmZzLlHhVvCcSsQqTtAa0-9,.Ee\n ]*)\""))
-
-;; Matches a complete <glyph> element with the glyph-name
-;; attribute value of NAME.  For example:
-;;
-;; <glyph glyph-name="period" unicode="." horiz-adv-x="110"
-;; d="M0 55c0 30 25 55 55 55s55 -25 55
-;; -55s-25 -55 -55 -55s-55 25 -55 55z" />
-;;
-;; TODO: it would be better to use an XML library to extract
-;; the glyphs instead, and store them in a hash table.  --pmccarty
-;;
-(define (glyph-element-regexp name)
-  (make-regexp (string-append "<glyph"
-                              "(([[:space:]]+[-a-z]+=\"[^\"]*\")+)?"
-                              "[[:space:]]+glyph-name=\"("
-                              name
-                              ")\""
-                              "(([[:space:]]+[-a-z]+=\"[^\"]*\")+)?"
-                              "([[:space:]]+)?"
-                              "/>")))
-
-(define (extract-glyph all-glyphs name size . rest)
-  (let* ((new-name (regexp-quote name))
-         (regexp (regexp-exec (glyph-element-regexp new-name) all-glyphs))
-         (glyph (match:substring regexp))
-         (unicode-attr (regexp-exec glyph-unicode-value-regexp glyph))
-         (unicode-attr-value (match:substring unicode-attr 1))
-         (unicode-attr? (regexp-match? unicode-attr))
-         (d-attr (regexp-exec glyph-path-regexp glyph))
-         (d-attr-value "")
-         (d-attr? (regexp-match? d-attr))
+  (make-regexp "[[:space:]]d=\"([-+MmZzLlHhVvCcSsQqTtAa0-9,.Ee\n ]*)\""))
+
+;; SVG font file name -> hash table from glyph name to path data
+;; ("" for glyphs without an outline, like "space").
+(define svg-font-glyph-tables (make-hash-table 7))
+
+(define (read-svg-font-glyphs svg-font)
+  (let ((table (make-hash-table 1031))
+        (contents (cached-file-contents svg-font)))
+    (let loop ((start 0))
+      (let ((match (regexp-exec glyph-element-regexp contents start)))
+        (if match
+            (let* ((attrs (match:substring match 1))
+                   (name (regexp-exec glyph-name-regexp attrs))
+                   (unicode-attr (regexp-exec glyph-unicode-value-regexp attrs))
+                   (d-attr (regexp-exec glyph-path-regexp attrs)))
+              (if (and (regexp-match? unicode-attr)
+                       (not (match:substring unicode-attr 1)))
+                  (ly:warning (_ "Glyph must have a unicode value")))
+              (if name
+                  (hash-set! table (match:substring name 1)
+                             (if d-attr (match:substring d-attr 1) "")))
+              (loop (match:end match))))))
+    table))
+
+(define (svg-font-glyphs svg-font)
+  (or (hash-ref svg-font-glyph-tables svg-font)
+      (let ((table (read-svg-font-glyphs svg-font)))
+        (hash-set! svg-font-glyph-tables svg-font table)
+        table)))
+
+;; Glyph outlines used in the current document.  Every outline is
+;; written once, into a <defs> element at the end of the document,
+;; and referenced by a <use> element for each occurrence.
+(define glyph-def-ids (make-hash-table 257))
+(define glyph-defs '())
+
+(define (glyph-def-id svg-font name path)
+  (let ((key (string-append svg-font ":" name)))
+    (or (hash-ref glyph-def-ids key)
+        (let ((id (format #f "lily-glyph-~a" (length glyph-defs))))
+          (hash-set! glyph-def-ids key id)
+          (set! glyph-defs
+                (cons (eoc 'path `(id . ,id) `(d . ,path)) glyph-defs))
+          id))))
+
+(define-public (glyph-defs-end)
+  "Return the outlines of the glyphs used since the last call as
+a @code{<defs>} element, and forget them."
+  (let ((defs (reverse! glyph-defs)))
+    (set! glyph-defs '())
+    (set! glyph-def-ids (make-hash-table 257))
+    (if (null? defs)
+        ""
+        (string-append (eo 'defs #t)
+                       (string-concatenate defs)
+                       (ec 'defs)))))
+
+(define (extract-glyph svg-font name size . rest)
+  (let* ((path (hash-ref (svg-font-glyphs svg-font) name))
          ;; TODO: not urgent, but do not hardcode this value
          (units-per-em 1000)
-         (font-scale (ly:format "~4f" (/ size units-per-em)))
-         (path ""))
-
-    (if (and unicode-attr? (not unicode-attr-value))
-        (ly:warning (_ "Glyph must have a unicode value")))
-
-    (if d-attr? (set! d-attr-value (match:substring d-attr 1)))
-
-    (cond (
-           ;; Glyph-strings with path data
-           (and d-attr? (not (null? rest)))
-           (begin
-             (set! path (apply dump-path d-attr-value
-                               font-scale
-                               (list (caddr rest) (cadddr rest))))
+         (font-scale (ly:format "~4f" (/ size units-per-em))))
+
+    (cond ((not path)
+           (ly:warning (_ "cannot find glyph ~S in SVG font ~S")
+                       name svg-font)
+           "")
+          ;; Glyph-strings with path data
+          ((and (not (string-null? path)) (not (null? rest)))
+           (let ((use (dump-glyph-use (glyph-def-id svg-font name path)
+                                      font-scale
+                                      (caddr rest) (cadddr rest))))
              (set! next-horiz-adv (+ next-horiz-adv
                                      (car rest)))
-             path))
+             use))
           ;; Glyph-strings without path data ("space")
-          ((and (not d-attr?) (not (null? rest)))
-           (begin
-             (set! next-horiz-adv (+ next-horiz-adv
-                                     (car rest)))
-             ""))
+          ((not (null? rest))
+           (set! next-horiz-adv (+ next-horiz-adv
+                                   (car rest)))
+           "")
           ;; Font smobs with path data
-          ((and d-attr? (null? rest))
-           (set! path (dump-path d-attr-value font-scale))
-           path)
+          ((not (string-null? path))
+           (dump-glyph-use (glyph-def-id svg-font name path) font-scale))
           ;; Font smobs without path data ("space")
           (else
            ""))))
 
-(define (extract-glyph-info all-glyphs glyph size)
+(define (extract-glyph-info svg-font glyph size)
   (let* ((offsets (list-head glyph 4))
          (glyph-name (car (reverse glyph))))
-    (apply extract-glyph all-glyphs glyph-name size offsets)))
-
-(define (svg-defs svg-font)
-  (let ((start (string-contains svg-font "<defs>"))
-        (end (string-contains svg-font "</defs>")))
-    (substring svg-font (+ start 7) (- end 1))))
+    (apply extract-glyph svg-font glyph-name size offsets)))
 
 (define (cache-font svg-font size glyph)
-  (let ((all-glyphs (svg-defs (cached-file-contents svg-font))))
-    (if (list? glyph)
-        (extract-glyph-info all-glyphs glyph size)
-        (extract-glyph all-glyphs glyph size))))
+  (if (list? glyph)
+      (extract-glyph-info svg-font glyph size)
+      (extract-glyph svg-font glyph size)))
 
 
 (define (music-string-to-path font size glyph)
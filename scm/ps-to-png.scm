@@ -43,6 +43,66 @@
                                   header))))
     (if match (string->number (match:substring match 1)) 0)))
 
+(define (split-page-range page-count job-count)
+  "Split pages 1 to PAGE-COUNT into JOB-COUNT ranges of consecutive
+pages, as a list of @code{(first . last)} pairs."
+  (let ((size (quotient page-count job-count))
+        (extra (remainder page-count job-count)))
+    (let loop ((job 0) (first 1) (acc '()))
+      (if (= job job-count)
+          (reverse! acc)
+          (let ((last (+ first size (if (< job extra) 0 -1))))
+            (loop (1+ job) (1+ last) (cons (cons first last) acc)))))))
+
+;; Leave a forked child without flushing the stdio buffers it shares
+;; with the parent.  Guile 1.8 lacks primitive-_exit.
+(define child-exit
+  (if (defined? 'primitive-_exit) primitive-_exit primitive-exit))
+
+(define (run-ghostscript-jobs gs-args run-strings)
+  "Run Ghostscript with GS-ARGS for each of RUN-STRINGS.  All but the
+first run in forked processes, each with its own Ghostscript
+instance."
+  (define gs-api? (ly:get-option 'gs-api))
+  (define (run run-string)
+    ((if gs-api? ly:gs-api ly:gs-cli) gs-args run-string))
+
+  ;; A Ghostscript instance must not be shared with the children.
+  (if gs-api?
+      (ly:shutdown-gs))
+  (let* ((pids '())
+         (start-child
+          (lambda (run-string)
+            (let ((pid (primitive-fork)))
+              (if (= pid 0)
+                  ;; Do not flush the output buffers we inherited, or
+                  ;; run any exit handlers.
+                  (child-exit
+                   (catch #t
+                          (lambda ()
+                            (run run-string)
+                            (if gs-api?
+                                (ly:shutdown-gs))
+                            0)
+                          (lambda (key . args) 1))))
+              (set! pids (cons pid pids)))))
+         ;; Whatever goes wrong here, the children that were started
+         ;; must be reaped before we return or rethrow.
+         (failure (catch #t
+                         (lambda ()
+                           (for-each start-child (cdr run-strings))
+                           (run (car run-strings))
+                           #f)
+                         (lambda (key . args) (cons key args))))
+         (failed (remove (lambda (pid)
+                           (eqv? 0 (status:exit-val (cdr (waitpid pid)))))
+                         pids)))
+    (if (pair? failed)
+        (ly:warning (_ "~a of ~a Ghostscript jobs failed")
+                    (length failed) (length run-strings)))
+    (cond (failure (apply throw failure))
+          ((pair? failed) (throw 'ly-file-failed)))))
+
 (define-public (make-ps-images base-name tmp-name is-eps . rest)
   (let-keywords*
    rest #f
@@ -61,66 +121,109 @@
                       ((string-contains format-str "jpeg") "jpeg")
                       (else
                        (ly:error "Unknown pixmap format ~a" pixmap-format))))
-          (pngn (format #f "~a-page%d.~a" tmp-name extension))
           (page-count (if is-eps 1 (ps-page-count tmp-name)))
           (multi-page? (> page-count 1))
 
+          ;; With -dgs-jobs, every job renders a range of pages into
+          ;; files of its own.
+          (job-count (let ((jobs (ly:get-option 'gs-jobs)))
+                       (if (and (integer? jobs) multi-page?)
+                           (max 1 (min jobs page-count))
+                           1)))
+          (page-ranges (if (> job-count 1)
+                           (split-page-range page-count job-count)
+                           '()))
+          (job-name (lambda (job)
+                      (if (> job-count 1)
+                          (ly:format "~a-job~a" tmp-name job)
+                          tmp-name)))
+
           ;; Escape `%' (except `page%d') for ghostscript
-          (base-name-gs (string-join
-                         (string-split tmp-name #\%)
-                         "%%"))
-          (pngn-gs (format #f "~a-page%d.~a" base-name-gs extension))
+          (escape-gs (lambda (name)
+                       (string-join (string-split name #\%) "%%")))
+          (base-name-gs (escape-gs tmp-name))
 
           (hw-resolution (* anti-alias-factor resolution))
-          (run-strings
-           (filter
-            string?
-            (list
-             (ly:format "mark /OutputFile (~a)" pngn-gs)
-             "/GraphicsAlphaBits 4 /TextAlphaBits 4"
-             (ly:format "/HWResolution [~a ~a]" hw-resolution hw-resolution)
-             (ly:format "/DownScaleFactor ~a" anti-alias-factor)
-             (if (not is-eps)
-                 (ly:format "/PageSize [~a ~a]" page-width page-height))
-             ;; We use `findprotodevice` because `finddevice` always returns
-             ;; the same device instance and we can't reset the page number of
-             ;; the device. `findprotodevice copydevice` creates a new device
-             ;; instance each time, which can reset the page number.
-             (ly:format "(~a) findprotodevice copydevice" pixmap-format)
-             "putdeviceprops setdevice"
-             ;; We want to use `selectdevice` instead of `setdevice` because
-             ;; `setdevice` doesn't set some defaults. But using `selectdevice`
-             ;; can't reset the page number because `selectdevice` uses
-             ;; `finddevice` internally. So, as a workaround, we use an
-             ;; undocumented `.setdefaultscreen` procedure which is used inside
-             ;; `selectdevice` to set the defaults. It works in Ghostscript
-             ;; 9.52 but may not work if the internal implementation of
-             ;; `selectdevice` is changed in the future.
-             "/.setdefaultscreen where {"
-             "pop .setdefaultscreen"
-             "} {"
-             "(Warning: .setdefaultscreen not available) print"
-             "} ifelse"
-             ;; Enable writing to the formattable OutputFile with a wildcard.
-             ;; (When setting -sOutputFile from the command line, this happens
-             ;; in gs_main_add_outputfile_control_path.)
-             "/.addcontrolpath where { pop"
-             (ly:format "/PermitFileWriting (~a*) .addcontrolpath" base-name-gs)
-             "} if"
-             (gs-safe-run tmp-name)))))
-
-     ((if (ly:get-option 'gs-api)
-          ly:gs-api ly:gs-cli)
-      (gs-cmd-args is-eps) (string-join run-strings " "))
+          (run-string
+           (lambda (job)
+             (string-join
+              (filter
+               string?
+               (list
+                (ly:format "mark /OutputFile (~a-page%d.~a)"
+                           (escape-gs (job-name job)) extension)
+                "/GraphicsAlphaBits 4 /TextAlphaBits 4"
+                (ly:format "/HWResolution [~a ~a]" hw-resolution hw-resolution)
+                (ly:format "/DownScaleFactor ~a" anti-alias-factor)
+                (if (not is-eps)
+                    (ly:format "/PageSize [~a ~a]" page-width page-height))
+                (if (> job-count 1)
+                    (let ((range (list-ref page-ranges job)))
+                      (ly:format "/FirstPage ~a /LastPage ~a"
+                                 (car range) (cdr range))))
+                ;; We use `findprotodevice` because `finddevice` always
+                ;; returns the same device instance and we can't reset the
+                ;; page number of the device. `findprotodevice copydevice`
+                ;; creates a new device instance each time, which can reset
+                ;; the page number.
+                (ly:format "(~a) findprotodevice copydevice" pixmap-format)
+                "putdeviceprops setdevice"
+                ;; We want to use `selectdevice` instead of `setdevice`
+                ;; because `setdevice` doesn't set some defaults. But using
+                ;; `selectdevice` can't reset the page number because
+                ;; `selectdevice` uses `finddevice` internally. So, as a
+                ;; workaround, we use an undocumented `.setdefaultscreen`
+                ;; procedure which is used inside `selectdevice` to set the
+                ;; defaults. It works in Ghostscript 9.52 but may not work if
+                ;; the internal implementation of `selectdevice` is changed
+                ;; in the future.
+                "/.setdefaultscreen where {"
+                "pop .setdefaultscreen"
+                "} {"
+                "(Warning: .setdefaultscreen not available) print"
+                "} ifelse"
+                ;; Enable writing to the formattable OutputFile with a
+                ;; wildcard.  (When setting -sOutputFile from the command
+                ;; line, this happens in
+                ;; gs_main_add_outputfile_control_path.)
+                "/.addcontrolpath where { pop"
+                (ly:format "/PermitFileWriting (~a*) .addcontrolpath"
+                           base-name-gs)
+                "} if"
+                (gs-safe-run tmp-name)))
+              " ")))
+
+          ;; The file Ghostscript wrote for page N, counting from 1.
+          ;; The pages a job skips are not counted.
+          (page-file
+           (lambda (n)
+             (let loop ((job 0) (ranges page-ranges))
+               (if (or (null? ranges) (<= n (cdar ranges)))
+                   (ly:format "~a-page~a.~a"
+                              (job-name job)
+                              (if (pair? ranges) (- n (caar ranges) -1) n)
+                              extension)
+                   (loop (1+ job) (cdr ranges)))))))
+
+     (if (> job-count 1)
+         (begin
+           (ly:debug (_ "Rendering ~a pages in ~a Ghostscript jobs")
+                     page-count job-count)
+           (run-ghostscript-jobs (gs-cmd-args is-eps)
+                                 (map run-string (iota job-count))))
+         ((if (ly:get-option 'gs-api)
+              ly:gs-api ly:gs-cli)
+          (gs-cmd-args is-eps) (run-string 0)))
 
      (map (lambda (n)
             (let*
-                ((src (ly:format "~a-page~a.~a" tmp-name (1+ n) extension))
+                ((src (page-file (1+ n)))
                  (dst
                   (if (or (not multi-page?) (and multi-page? rename-page-1))
                       (ly:format "~a.~a" base-name extension)
                       (ly:format "~a-page~a.~a" base-name (1+ n) extension))))
               (ly:rename-file src dst)
+              (ly:note-output-file dst)
               dst))
           (iota page-count))
      )))
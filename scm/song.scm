@@ -60,6 +60,7 @@
       (debug-enable 'backtrace))
   (ly:message "Writing Festival XML file ~a..." filename)
   (let ((port (open-output-file filename)))
+    (ly:note-output-file filename)
     (write-header port tempo)
     (write-lyrics port music)
     (write-footer port)
@@ -1099,4 +1099,5 @@ grestore
                                  (ly:stencil-expr
                                   (paper-system-stencil paper-system)))))
 
-  (close-port-rename output filename))
+  (close-port-rename output filename)
+  (ly:note-output-file filename))
@@ -0,0 +1,246 @@
+# run-benchmarks.py
+# -*- coding: utf-8 -*-
+#
+# This file is part of LilyPond, the GNU music typesetter.
+#
+# Copyright (C) 2020 Han-Wen Nienhuys <hanwen@xs4all.nl>
+#
+# LilyPond is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# LilyPond is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with LilyPond.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Time LilyPond on the scores listed in input/benchmark/benchmarks.txt.
+
+Every score is run several times.  The median wall clock time, the
+time spent in each processing phase (from -dphase-timeline), the
+share of garbage collection in the run time and the peak memory use
+are written to a JSON file.  Given a baseline from an
+earlier run, the script reports the differences and exits with status
+1 when a score got significantly slower or bigger.
+
+A difference is significant when it exceeds both the relative
+threshold and the noise seen between the runs of the baseline and
+the new run.
+"""
+
+import json
+import optparse
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def read_benchmark_list(input_dir):
+    """Return (weight, file name) pairs from benchmarks.txt."""
+    benchmarks = []
+    list_name = os.path.join(input_dir, 'benchmark', 'benchmarks.txt')
+    with open(list_name, encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            weight, name = line.split(None, 1)
+            benchmarks.append((float(weight), name))
+    return benchmarks
+
+
+def run_once(options, input_file, output_base):
+    """Run LilyPond on INPUT_FILE; return wall time and phase timeline."""
+    fd, timeline_name = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    cmd = [options.lilypond,
+           '--loglevel=ERROR',
+           '-dno-point-and-click',
+           '-dphase-timeline=' + timeline_name,
+           '-o', output_base,
+           input_file]
+    try:
+        start = time.monotonic()
+        status = subprocess.call(cmd)
+        wall = time.monotonic() - start
+        if status != 0:
+            sys.stderr.write('%s failed with status %d\n'
+                             % (' '.join(cmd), status))
+            return None
+        with open(timeline_name, encoding='utf-8') as f:
+            timeline = json.load(f)
+    finally:
+        os.unlink(timeline_name)
+    return wall, timeline
+
+
+def summarize(runs):
+    """Reduce several (wall, timeline) results to one record."""
+    walls = [wall for (wall, timeline) in runs]
+
+    phase_times = {}
+    gc_fractions = []
+    peak_rss = 0
+    for (wall, timeline) in runs:
+        totals = {}
+        gc_time = 0.0
+        for phase in timeline['phases']:
+            name = phase['name']
+            totals[name] = totals.get(name, 0.0) + phase['self-wall']
+            peak_rss = max(peak_rss, phase['peak-rss-kb'])
+            if phase['depth'] == 0:
+                gc_time += phase.get('gc-time', 0.0)
+        for (name, t) in totals.items():
+            phase_times.setdefault(name, []).append(t)
+        gc_fractions.append(gc_time / wall if wall > 0 else 0.0)
+
+    return {
+        'wall': walls,
+        'median': statistics.median(walls),
+        'phases': dict((name, statistics.median(ts))
+                       for (name, ts) in phase_times.items()),
+        'gc-fraction': statistics.median(gc_fractions),
+        'peak-rss-kb': peak_rss,
+    }
+
+
+def noise(record):
+    """Half the spread of the run times of RECORD."""
+    return (max(record['wall']) - min(record['wall'])) / 2.0
+
+
+def compare(options, results, baseline):
+    """Print a comparison with BASELINE; return the list of regressions."""
+    regressions = []
+    total = 0.0
+    baseline_total = 0.0
+
+    print('%-50s %9s %9s %7s %7s %7s'
+          % ('score', 'base', 'now', 'change', 'gc base', 'gc now'))
+    for (name, record) in sorted(results['scores'].items()):
+        base = baseline['scores'].get(name)
+        if not base:
+            print('%-50s %9s %9.2f %7s %6.1f%%'
+                  % (name, '-', record['median'], '-',
+                     100 * record['gc-fraction']))
+            continue
+
+        weight = record['weight']
+        total += weight * record['median']
+        baseline_total += weight * base['median']
+
+        change = record['median'] / base['median'] - 1.0
+        print('%-50s %9.2f %9.2f %+6.1f%% %6.1f%% %6.1f%%'
+              % (name, base['median'], record['median'], 100 * change,
+                 100 * base.get('gc-fraction', 0.0),
+                 100 * record['gc-fraction']))
+
+        slack = max(options.min_noise, 2 * (noise(record) + noise(base)))
+        if (change > options.threshold
+                and record['median'] - base['median'] > slack):
+            regressions.append('%s: %.2fs -> %.2fs'
+                               % (name, base['median'], record['median']))
+            for (phase, t) in sorted(record['phases'].items()):
+                base_t = base['phases'].get(phase, 0.0)
+                if t - base_t > slack / 2:
+                    print('    %-46s %9.2f %9.2f' % (phase, base_t, t))
+
+        if base['peak-rss-kb'] > 0:
+            growth = record['peak-rss-kb'] / base['peak-rss-kb'] - 1.0
+            if growth > options.memory_threshold:
+                regressions.append('%s: peak memory %d kB -> %d kB'
+                                   % (name, base['peak-rss-kb'],
+                                      record['peak-rss-kb']))
+
+    if baseline_total > 0:
+        change = total / baseline_total - 1.0
+        print('%-50s %9.2f %9.2f %+6.1f%%'
+              % ('weighted total', baseline_total, total, 100 * change))
+        if change > options.total_threshold:
+            regressions.append('weighted total: %+.1f%%' % (100 * change))
+
+    return regressions
+
+
+def main():
+    p = optparse.OptionParser(usage='run-benchmarks.py [OPTION]...',
+                              description=__doc__)
+    p.add_option('--lilypond', default=os.environ.get('LILYPOND_BINARY',
+                                                      'lilypond'),
+                 help='the LilyPond binary to time')
+    p.add_option('--input-dir', default='input',
+                 help='the input/ directory of the source tree')
+    p.add_option('--output-dir', default='out/benchmark',
+                 help='where to write output files and results')
+    p.add_option('--runs', type='int', default=3,
+                 help='number of runs of each score')
+    p.add_option('--baseline',
+                 help='compare with the results in this file')
+    p.add_option('--save-baseline',
+                 help='also write the results to this file')
+    p.add_option('--threshold', type='float', default=0.10,
+                 help='relative slowdown of a score that fails the run')
+    p.add_option('--total-threshold', type='float', default=0.05,
+                 help='relative slowdown of the weighted total that'
+                 ' fails the run')
+    p.add_option('--memory-threshold', type='float', default=0.15,
+                 help='relative growth of peak memory that fails the run')
+    p.add_option('--min-noise', type='float', default=0.05,
+                 help='differences below this many seconds are noise')
+    (options, args) = p.parse_args()
+
+    os.makedirs(options.output_dir, exist_ok=True)
+
+    results = {'lilypond': options.lilypond, 'scores': {}}
+    failed = False
+    for (weight, name) in read_benchmark_list(options.input_dir):
+        input_file = os.path.join(options.input_dir, name)
+        output_base = os.path.join(options.output_dir,
+                                   os.path.splitext(name)[0])
+        os.makedirs(os.path.dirname(output_base), exist_ok=True)
+
+        sys.stderr.write('Timing %s...\n' % name)
+        runs = []
+        for i in range(options.runs):
+            result = run_once(options, input_file, output_base)
+            if result is None:
+                failed = True
+                break
+            runs.append(result)
+        if len(runs) == options.runs:
+            record = summarize(runs)
+            record['weight'] = weight
+            results['scores'][name] = record
+
+    results_name = os.path.join(options.output_dir, 'benchmark.json')
+    for file_name in [results_name, options.save_baseline]:
+        if file_name:
+            with open(file_name, 'w', encoding='utf-8') as f:
+                json.dump(results, f, indent=1, sort_keys=True)
+
+    if failed:
+        sys.stderr.write('*** some scores could not be processed\n')
+        return 2
+
+    if options.baseline:
+        with open(options.baseline, encoding='utf-8') as f:
+            baseline = json.load(f)
+        regressions = compare(options, results, baseline)
+        if regressions:
+            sys.stderr.write('\n*** significant regressions:\n')
+            for r in regressions:
+                sys.stderr.write('    %s\n' % r)
+            return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())